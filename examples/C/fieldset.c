@@ -56,8 +56,8 @@ int main(int argc, char** argv)
     set = codes_fieldset_new_from_files(0, filenames, nfiles, keys, nkeys, 0, 0, &err);
     CODES_CHECK(err, 0);
 
-    /* not yet implemented */
-    /* err=codes_fieldset_apply_where(set,"(centre=='ecmf') && number==1 || step==6 "); */
+    /* The where-clause can only refer to keys of the fieldset */
+    /* err=codes_fieldset_apply_where(set,"levelType=='pl' && (step=='0' || step=='6')"); */
     /* CODES_CHECK(err,0); */
 
     codes_fieldset_apply_order_by(set, order_by);
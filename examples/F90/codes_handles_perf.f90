@@ -0,0 +1,65 @@
+! (C) Copyright 2005- ECMWF.
+!
+! This software is licensed under the terms of the Apache Licence Version 2.0
+! which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+!
+! In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+! virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+!
+!
+!  Description: Overhead of codes_get/codes_set calls when many handles are live,
+!               i.e. of finding the handle of a Fortran id.
+!
+!  Usage: codes_handles_perf [number_of_handles [repetitions]]
+!
+program codes_handles_perf
+   use eccodes
+   implicit none
+   integer                            :: nhandles = 10000, repeat = 10
+   integer                            :: i, r, level, sample
+   integer, dimension(:), allocatable :: igrib
+   integer(kind=8)                    :: t0, t1, rate
+   character(len=32)                  :: arg
+
+   if (command_argument_count() >= 1) then
+      call get_command_argument(1, arg)
+      read (arg, *) nhandles
+   end if
+   if (command_argument_count() >= 2) then
+      call get_command_argument(2, arg)
+      read (arg, *) repeat
+   end if
+
+   allocate (igrib(nhandles))
+   call codes_grib_new_from_samples(sample, 'GRIB2')
+   do i = 1, nhandles
+      call codes_clone(sample, igrib(i))
+   end do
+
+   call system_clock(t0, rate)
+   do r = 1, repeat
+      do i = 1, nhandles
+         call codes_get(igrib(i), 'level', level)
+      end do
+   end do
+   call system_clock(t1)
+   write (*, '(i8,a,f10.3,a)') nhandles, ' handles: codes_get ', &
+      1.0d9*(t1 - t0)/rate/(repeat*nhandles), ' ns per call'
+
+   call system_clock(t0)
+   do r = 1, repeat
+      do i = 1, nhandles
+         call codes_set(igrib(i), 'level', r)
+      end do
+   end do
+   call system_clock(t1)
+   write (*, '(i8,a,f10.3,a)') nhandles, ' handles: codes_set ', &
+      1.0d9*(t1 - t0)/rate/(repeat*nhandles), ' ns per call'
+
+   do i = 1, nhandles
+      call codes_release(igrib(i))
+   end do
+   call codes_release(sample)
+   deallocate (igrib)
+
+end program codes_handles_perf
@@ -100,50 +100,15 @@ struct l_grib_file {
     l_grib_file* next;
 };
 
-typedef struct l_grib_handle l_grib_handle;
-
-struct l_grib_handle {
-    int id;
-    grib_handle* h;
-    l_grib_handle* next;
-};
-
-typedef struct l_grib_index l_grib_index;
-
-struct l_grib_index {
-    int id;
-    grib_index* h;
-    l_grib_index* next;
-};
-
-typedef struct l_grib_multi_handle l_grib_multi_handle;
-
-struct l_grib_multi_handle {
-    int id;
-    grib_multi_handle* h;
-    l_grib_multi_handle* next;
-};
-
-typedef struct l_grib_iterator l_grib_iterator;
-
-struct l_grib_iterator {
-    int id;
-    grib_iterator* i;
-    l_grib_iterator* next;
-};
-
-typedef struct l_grib_keys_iterator l_grib_keys_iterator;
-struct l_grib_keys_iterator {
-    int id;
-    grib_keys_iterator* i;
-    l_grib_keys_iterator* next;
-};
-
-typedef struct l_bufr_keys_iterator l_bufr_keys_iterator;
-struct l_bufr_keys_iterator {
-    int id;
-    bufr_keys_iterator* i;
-    l_bufr_keys_iterator* next;
+/* Objects handed out to Fortran are kept in tables indexed by their id,
+ * so that finding the object of an id does not depend on how many are live.
+ * As with the linked lists used before, the lowest free id is reused first */
+typedef struct l_id_table l_id_table;
+struct l_id_table {
+    void** items;   /* items[id-1] is NULL when id is free */
+    int size;       /* number of allocated items */
+    int count;      /* number of items used so far */
+    int first_free; /* no free item below this index */
 };
 
 typedef struct l_binary_message l_binary_message;
@@ -158,13 +123,15 @@ struct l_message_info {
     size_t size;
 };
 
-static l_grib_handle* handle_set = NULL;
-static l_grib_index* index_set = NULL;
-static l_grib_multi_handle* multi_handle_set = NULL;
+static l_id_table handle_set = {0,};
+static l_id_table index_set = {0,};
+static l_id_table multi_handle_set = {0,};
 static l_grib_file*   file_set   = NULL;
-/*static l_grib_iterator* iterator_set = NULL;*/
-static l_grib_keys_iterator* keys_iterator_set = NULL;
-static l_bufr_keys_iterator* bufr_keys_iterator_set = NULL;
+#ifdef FORTRAN_GEOITERATOR_SUPPORT
+static l_id_table iterator_set = {0,};
+#endif
+static l_id_table keys_iterator_set = {0,};
+static l_id_table bufr_keys_iterator_set = {0,};
 static grib_oarray* binary_messages = NULL;
 static grib_oarray* info_messages = NULL;
 
@@ -271,178 +238,57 @@ static int push_file(FILE* f, const char* open_mode, char* buffer)
     return myindex;
 }
 
-static void _push_handle(grib_handle *h,int *gid)
+static int id_table_push(l_id_table* t, void* p)
 {
-    l_grib_handle* current= NULL;
-    l_grib_handle* previous= handle_set;
-    l_grib_handle* the_new= NULL;
-    int myindex= 1;
-
-    /*
-  if (*gid > 0 ) {
-    while(current) {
-      if(current->id == *gid) break;
-      current = current->next;
-    }
-    if (current) {
-      grib_handle_delete(current->h);
-      current->h=h;
-      return;
-    }
-  }
-     */
-
-    if(!handle_set){
-        handle_set = (l_grib_handle*)malloc(sizeof(l_grib_handle));
-        Assert(handle_set);
-        handle_set->id   = myindex;
-        handle_set->h    = h;
-        handle_set->next = NULL;
-        *gid=myindex;
-        return;
+    int i = t->first_free;
+    while (i < t->count && t->items[i])
+        i++;
+    if (i == t->size) {
+        int size     = t->size ? 2 * t->size : 64;
+        void** items = (void**)realloc(t->items, size * sizeof(void*));
+        Assert(items);
+        t->items = items;
+        t->size  = size;
     }
+    if (i == t->count)
+        t->count++;
+    t->items[i]   = p;
+    t->first_free = i + 1;
+    return i + 1;
+}
 
-    current= handle_set;
+static void* id_table_get(const l_id_table* t, int id)
+{
+    if (id < 1 || id > t->count)
+        return NULL;
+    return t->items[id - 1];
+}
 
-    while(current){
-        if(current->id < 0){
-            current->id = -(current->id);
-            current->h  = h;
-            *gid=current->id;
-            return;
-        }
-        else{
-            myindex++;
-            previous = current;
-            current = current->next;
-        }
+/* Frees the id and returns its object, NULL if the id is not in use */
+static void* id_table_clear(l_id_table* t, int id)
+{
+    void* p = id_table_get(t, id);
+    if (p) {
+        t->items[id - 1] = NULL;
+        if (id - 1 < t->first_free)
+            t->first_free = id - 1;
     }
+    return p;
+}
 
-    the_new = (l_grib_handle*)malloc(sizeof(l_grib_handle));
-    Assert(the_new);
-    the_new->id   = myindex;
-    the_new->h    = h;
-    the_new->next = current;
-    previous->next = the_new;
-
-    *gid=myindex;
-    return;
+static void _push_handle(grib_handle *h,int *gid)
+{
+    *gid = id_table_push(&handle_set, h);
 }
 
 static void _push_index(grib_index *h,int *gid)
 {
-    l_grib_index* current= NULL;
-    l_grib_index* previous= index_set;
-    l_grib_index* the_new= NULL;
-    int myindex= 1;
-
-    /*
-    if (*gid > 0 ) {
-      while(current) {
-        if(current->id == *gid) break;
-        current = current->next;
-      }
-      if (current) {
-        grib_index_delete(current->h);
-        current->h=h;
-        return;
-      }
-    }
-    */
-
-    if(!index_set){
-        index_set = (l_grib_index*)malloc(sizeof(l_grib_index));
-        Assert(index_set);
-        index_set->id   = myindex;
-        index_set->h    = h;
-        index_set->next = NULL;
-        *gid=myindex;
-        return;
-    }
-
-    current= index_set;
-
-    while(current){
-        if(current->id < 0){
-            current->id = -(current->id);
-            current->h  = h;
-            *gid=current->id;
-            return;
-        }
-        else{
-            myindex++;
-            previous = current;
-            current = current->next;
-        }
-    }
-
-    the_new = (l_grib_index*)malloc(sizeof(l_grib_index));
-    Assert(the_new);
-    the_new->id   = myindex;
-    the_new->h    = h;
-    the_new->next = current;
-    previous->next = the_new;
-
-    *gid=myindex;
-    return;
+    *gid = id_table_push(&index_set, h);
 }
 
 static void _push_multi_handle(grib_multi_handle *h,int *gid)
 {
-    l_grib_multi_handle* current= NULL;
-    l_grib_multi_handle* previous= multi_handle_set;
-    l_grib_multi_handle* the_new= NULL;
-    int myindex= 1;
-
-    /*
-    if (*gid > 0 ) {
-        while(current) {
-          if(current->id == *gid) break;
-          current = current->next;
-        }
-        if (current) {
-          grib_multi_handle_delete(current->h);
-          current->h=h;
-          return;
-        }
-    }
-    */
-
-    if(!multi_handle_set){
-        multi_handle_set = (l_grib_multi_handle*)malloc(sizeof(l_grib_multi_handle));
-        Assert(multi_handle_set);
-        multi_handle_set->id   = myindex;
-        multi_handle_set->h    = h;
-        multi_handle_set->next = NULL;
-        *gid=myindex;
-        return;
-    }
-
-    current= multi_handle_set;
-
-    while(current){
-        if(current->id < 0){
-            current->id = -(current->id);
-            current->h  = h;
-            *gid=current->id;
-            return;
-        }
-        else{
-            myindex++;
-            previous = current;
-            current = current->next;
-        }
-    }
-
-    the_new = (l_grib_multi_handle*)malloc(sizeof(l_grib_multi_handle));
-    Assert(the_new);
-    the_new->id   = myindex;
-    the_new->h    = h;
-    the_new->next = current;
-    previous->next = the_new;
-
-    *gid=myindex;
-    return;
+    *gid = id_table_push(&multi_handle_set, h);
 }
 
 static void push_handle(grib_handle *h,int *gid)
@@ -474,42 +320,7 @@ static void push_multi_handle(grib_multi_handle *h,int *gid)
 
 static int _push_keys_iterator(grib_keys_iterator *i)
 {
-    l_grib_keys_iterator* current  = keys_iterator_set;
-    l_grib_keys_iterator* previous = keys_iterator_set;
-    l_grib_keys_iterator* the_new      = NULL;
-    int myindex = 1;
-
-    if(!keys_iterator_set){
-        keys_iterator_set = (l_grib_keys_iterator*)malloc(sizeof(l_grib_keys_iterator));
-        Assert(keys_iterator_set);
-        keys_iterator_set->id   = myindex;
-        keys_iterator_set->i    = i;
-        keys_iterator_set->next = NULL;
-        return myindex;
-    }
-
-    while(current){
-        if(current->id < 0){
-            current->id = -(current->id);
-            current->i  = i;
-            return current->id;
-        }
-        else{
-            myindex++;
-            previous = current;
-            current = current->next;
-        }
-    }
-    if(!previous) return -1;
-
-    the_new = (l_grib_keys_iterator*)malloc(sizeof(l_grib_keys_iterator));
-    Assert(the_new);
-    the_new->id   = myindex;
-    the_new->i    = i;
-    the_new->next = current;
-    previous->next = the_new;
-
-    return myindex;
+    return id_table_push(&keys_iterator_set, i);
 }
 
 static int push_keys_iterator(grib_keys_iterator *i)
@@ -525,42 +336,7 @@ static int push_keys_iterator(grib_keys_iterator *i)
 /* BUFR Keys iterator */
 static int _push_bufr_keys_iterator(bufr_keys_iterator *i)
 {
-    l_bufr_keys_iterator* current  = bufr_keys_iterator_set;
-    l_bufr_keys_iterator* previous = bufr_keys_iterator_set;
-    l_bufr_keys_iterator* the_new  = NULL;
-    int myindex = 1;
-
-    if(!bufr_keys_iterator_set){
-        bufr_keys_iterator_set = (l_bufr_keys_iterator*)malloc(sizeof(l_bufr_keys_iterator));
-        Assert(bufr_keys_iterator_set);
-        bufr_keys_iterator_set->id   = myindex;
-        bufr_keys_iterator_set->i    = i;
-        bufr_keys_iterator_set->next = NULL;
-        return myindex;
-    }
-
-    while(current){
-        if(current->id < 0){
-            current->id = -(current->id);
-            current->i  = i;
-            return current->id;
-        }
-        else{
-            myindex++;
-            previous = current;
-            current = current->next;
-        }
-    }
-    if(!previous) return -1;
-
-    the_new = (l_bufr_keys_iterator*)malloc(sizeof(l_bufr_keys_iterator));
-    Assert(the_new);
-    the_new->id    = myindex;
-    the_new->i     = i;
-    the_new->next  = current;
-    previous->next = the_new;
-
-    return myindex;
+    return id_table_push(&bufr_keys_iterator_set, i);
 }
 static int push_bufr_keys_iterator(bufr_keys_iterator *i)
 {
@@ -575,35 +351,17 @@ static int push_bufr_keys_iterator(bufr_keys_iterator *i)
 
 static grib_handle* _get_handle(int handle_id)
 {
-    l_grib_handle* current= handle_set;
-
-    while(current){
-        if(current->id == handle_id) return current->h;
-        current = current->next;
-    }
-    return NULL;
+    return (grib_handle*)id_table_get(&handle_set, handle_id);
 }
 
 static grib_index* _get_index(int index_id)
 {
-    l_grib_index* current= index_set;
-
-    while(current){
-        if(current->id == index_id) return current->h;
-        current = current->next;
-    }
-    return NULL;
+    return (grib_index*)id_table_get(&index_set, index_id);
 }
 
 static grib_multi_handle* _get_multi_handle(int multi_handle_id)
 {
-    l_grib_multi_handle* current= multi_handle_set;
-
-    while(current){
-        if(current->id == multi_handle_id) return current->h;
-        current = current->next;
-    }
-    return NULL;
+    return (grib_multi_handle*)id_table_get(&multi_handle_set, multi_handle_id);
 }
 
 static grib_handle* get_handle(int handle_id)
@@ -651,13 +409,7 @@ static FILE* get_file(int file_id)
 
 static grib_keys_iterator* _get_keys_iterator(int keys_iterator_id)
 {
-    l_grib_keys_iterator* current  = keys_iterator_set;
-
-    while(current){
-        if(current->id == keys_iterator_id) return current->i;
-        current = current->next;
-    }
-    return NULL;
+    return (grib_keys_iterator*)id_table_get(&keys_iterator_set, keys_iterator_id);
 }
 static grib_keys_iterator* get_keys_iterator(int keys_iterator_id)
 {
@@ -672,13 +424,7 @@ static grib_keys_iterator* get_keys_iterator(int keys_iterator_id)
 /* BUFR */
 static bufr_keys_iterator* _get_bufr_keys_iterator(int keys_iterator_id)
 {
-    l_bufr_keys_iterator* current  = bufr_keys_iterator_set;
-
-    while(current){
-        if(current->id == keys_iterator_id) return current->i;
-        current = current->next;
-    }
-    return NULL;
+    return (bufr_keys_iterator*)id_table_get(&bufr_keys_iterator_set, keys_iterator_id);
 }
 static bufr_keys_iterator* get_bufr_keys_iterator(int keys_iterator_id)
 {
@@ -720,47 +466,23 @@ static int clear_file(int file_id)
 
 static int _clear_handle(int handle_id)
 {
-    l_grib_handle* current  = handle_set;
-    if (handle_id<0) return 0;
-    while(current){
-        if(current->id == handle_id){
-            current->id = -(current->id);
-            if(current->h) return grib_handle_delete(current->h);
-        }
-        current = current->next;
-    }
+    grib_handle* h = (grib_handle*)id_table_clear(&handle_set, handle_id);
+    if (h) return grib_handle_delete(h);
     return GRIB_SUCCESS;
 }
 
 static int _clear_index(int index_id)
 {
-    l_grib_index* current  = index_set;
-
-    while(current){
-        if(current->id == index_id){
-            current->id = -(current->id);
-            if (current->h) {
-                grib_index_delete(current->h);
-                return GRIB_SUCCESS;
-            }
-        }
-        current = current->next;
-    }
+    grib_index* h = (grib_index*)id_table_clear(&index_set, index_id);
+    if (h) grib_index_delete(h);
     return GRIB_SUCCESS;
 }
 
 #if 0
 static int _clear_multi_handle(int multi_handle_id)
 {
-    l_grib_multi_handle* current  = multi_handle_set;
-
-    while(current){
-        if(current->id == multi_handle_id){
-            current->id = -(current->id);
-            if(current->h) return grib_multi_handle_delete(current->h);
-        }
-        current = current->next;
-    }
+    grib_multi_handle* h = (grib_multi_handle*)id_table_clear(&multi_handle_set, multi_handle_id);
+    if (h) return grib_multi_handle_delete(h);
     return GRIB_SUCCESS;
 }
 #endif
@@ -799,15 +521,8 @@ static int clear_multi_handle(int multi_handle_id)
 
 static int _clear_keys_iterator(int keys_iterator_id)
 {
-    l_grib_keys_iterator* current  = keys_iterator_set;
-
-    while(current){
-        if(current->id == keys_iterator_id){
-            current->id = -(current->id);
-            return grib_keys_iterator_delete(current->i);
-        }
-        current = current->next;
-    }
+    grib_keys_iterator* i = (grib_keys_iterator*)id_table_clear(&keys_iterator_set, keys_iterator_id);
+    if (i) return grib_keys_iterator_delete(i);
     return GRIB_INVALID_KEYS_ITERATOR;
 }
 static int clear_keys_iterator(int keys_iterator_id)
@@ -823,15 +538,8 @@ static int clear_keys_iterator(int keys_iterator_id)
 /* BUFR */
 static int _clear_bufr_keys_iterator(int keys_iterator_id)
 {
-    l_bufr_keys_iterator* current  = bufr_keys_iterator_set;
-
-    while(current){
-        if(current->id == keys_iterator_id){
-            current->id = -(current->id);
-            return codes_bufr_keys_iterator_delete(current->i);
-        }
-        current = current->next;
-    }
+    bufr_keys_iterator* i = (bufr_keys_iterator*)id_table_clear(&bufr_keys_iterator_set, keys_iterator_id);
+    if (i) return codes_bufr_keys_iterator_delete(i);
     return GRIB_INVALID_KEYS_ITERATOR;
 }
 static int clear_bufr_keys_iterator(int keys_iterator_id)
@@ -1013,41 +721,7 @@ int grib_f_multi_support_off_(void)
 #ifdef FORTRAN_GEOITERATOR_SUPPORT
 static int _push_iterator(grib_iterator *i)
 {
-    l_grib_iterator* current  = iterator_set;
-    l_grib_iterator* previous = iterator_set;
-    l_grib_iterator* the_new      = NULL;
-    int myindex = 1;
-
-    if(!iterator_set){
-        iterator_set = (l_grib_iterator*)malloc(sizeof(l_grib_iterator));
-        Assert(iterator_set);
-        iterator_set->id   = myindex;
-        iterator_set->i    = i;
-        iterator_set->next = NULL;
-        return myindex;
-    }
-
-    while(current){
-        if(current->id < 0){
-            current->id = -(current->id);
-            current->i  = i;
-            return current->id;
-        }
-        else{
-            myindex++;
-            previous = current;
-            current = current->next;
-        }
-    }
-
-    the_new = (l_grib_iterator*)malloc(sizeof(l_grib_iterator));
-    Assert(the_new);
-    the_new->id   = myindex;
-    the_new->i    = i;
-    the_new->next = current;
-    previous->next = the_new;
-
-    return myindex;
+    return id_table_push(&iterator_set, i);
 }
 static int push_iterator(grib_iterator *i)
 {
@@ -1060,13 +734,7 @@ static int push_iterator(grib_iterator *i)
 }
 static grib_iterator* _get_iterator(int iterator_id)
 {
-    l_grib_iterator* current  = iterator_set;
-
-    while(current){
-        if(current->id == iterator_id) return current->i;
-        current = current->next;
-    }
-    return NULL;
+    return (grib_iterator*)id_table_get(&iterator_set, iterator_id);
 }
 static grib_iterator* get_iterator(int iterator_id)
 {
@@ -1079,15 +747,8 @@ static grib_iterator* get_iterator(int iterator_id)
 }
 static int _clear_iterator(int iterator_id)
 {
-    l_grib_iterator* current  = iterator_set;
-
-    while(current){
-        if(current->id == iterator_id){
-            current->id = -(current->id);
-            return grib_iterator_delete(current->i);
-        }
-        current = current->next;
-    }
+    grib_iterator* i = (grib_iterator*)id_table_clear(&iterator_set, iterator_id);
+    if (i) return grib_iterator_delete(i);
     return GRIB_INVALID_ITERATOR;
 }
 static int clear_iterator(int iterator_id)
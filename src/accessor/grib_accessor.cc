@@ -57,6 +57,41 @@ int grib_accessor::compare_accessors(grib_accessor* a2, int compare_flags)
     return ret;
 }
 
+// Each accessor is preceded by the arena it came from and its size, as it
+// may be deleted without its handle at hand
+struct accessor_header
+{
+    grib_arena* arena;
+    size_t size;
+};
+#define ACCESSOR_HEADER 16
+static_assert(sizeof(accessor_header) <= ACCESSOR_HEADER, "accessor_header too big");
+
+void* grib_accessor::operator new(size_t size, grib_handle* h)
+{
+    grib_arena* arena = h ? grib_handle_arena(h) : NULL;
+    char* p           = (char*)grib_arena_malloc_clear(arena, size + ACCESSOR_HEADER);
+    if (!p)
+        throw std::bad_alloc();
+    ((accessor_header*)p)->arena = arena;
+    ((accessor_header*)p)->size  = size + ACCESSOR_HEADER;
+    return p + ACCESSOR_HEADER;
+}
+
+void grib_accessor::operator delete(void* p, grib_handle* h)
+{
+    grib_accessor::operator delete(p);
+}
+
+void grib_accessor::operator delete(void* p)
+{
+    accessor_header* header;
+    if (!p)
+        return;
+    header = (accessor_header*)((char*)p - ACCESSOR_HEADER);
+    grib_arena_free(header->arena, header, header->size);
+}
+
 int grib_accessor::add_attribute(grib_accessor* attr, int nest_if_clash)
 {
     int id              = 0;
@@ -77,7 +112,9 @@ int grib_accessor::add_attribute(grib_accessor* attr, int nest_if_clash)
     for (id = 0; id < MAX_ACCESSOR_ATTRIBUTES; id++) {
         if (pAloc->attributes[id] == NULL) {
             // attr->parent=a->parent;
-            pAloc->attributes[id]      = attr;
+            int err = pAloc->attributes.set(this->context, id, attr);
+            if (err)
+                return err;
             attr->parent_as_attribute = pAloc;
             if (pAloc->same)
                 attr->same = pAloc->same->get_attribute_index(attr->name, &idx);
@@ -12,6 +12,73 @@
 
 #include "grib_api_internal.h"
 #include "grib_value.h"
+#include <array>
+
+// Fixed-capacity list of up to N names or attributes. Reading a slot that was
+// never set gives NULL. The first Inline slots live in the object, the others
+// are allocated on first use: most accessors have no alias or attribute and
+// should not pay for N empty pointers each.
+template <typename T, int N, int Inline>
+class grib_accessor_slots
+{
+public:
+    grib_accessor_slots() = default;
+    grib_accessor_slots(const grib_accessor_slots&) = delete;
+    grib_accessor_slots& operator=(const grib_accessor_slots&) = delete;
+
+    T operator[](int i) const
+    {
+        if (i < Inline)
+            return i < 0 ? nullptr : first_[i];
+        return (i - Inline) < capacity_ ? rest_[i - Inline] : nullptr;
+    }
+
+    // Returns GRIB_OUT_OF_MEMORY if the out-of-line part cannot be grown
+    int set(grib_context* c, int i, T v)
+    {
+        Assert(i >= 0 && i < N);
+        if (i < Inline) {
+            first_[i] = v;
+            return GRIB_SUCCESS;
+        }
+        i -= Inline;
+        if (i >= capacity_) {
+            if (v == nullptr)
+                return GRIB_SUCCESS;
+            int capacity = capacity_ ? capacity_ : 2;
+            while (capacity <= i)
+                capacity *= 2;
+            if (capacity > N - Inline)
+                capacity = N - Inline;
+            T* rest = (T*)grib_context_malloc_clear(c, capacity * sizeof(T));
+            if (!rest)
+                return GRIB_OUT_OF_MEMORY;
+            if (rest_)
+                memcpy(rest, rest_, capacity_ * sizeof(T));
+            grib_context_free(c, rest_);
+            rest_     = rest;
+            capacity_ = capacity;
+        }
+        rest_[i] = v;
+        return GRIB_SUCCESS;
+    }
+
+    void release(grib_context* c)
+    {
+        grib_context_free(c, rest_);
+        rest_     = nullptr;
+        capacity_ = 0;
+    }
+
+private:
+    T* rest_ = nullptr;
+    std::array<T, Inline> first_{};
+    unsigned char capacity_ = 0;
+    static_assert(N - Inline <= 255, "grib_accessor_slots: too many slots");
+};
+
+typedef grib_accessor_slots<const char*, MAX_ACCESSOR_NAMES, 1> grib_accessor_names;
+typedef grib_accessor_slots<grib_accessor*, MAX_ACCESSOR_ATTRIBUTES, 0> grib_accessor_attributes;
 
 class grib_accessor
 {
@@ -21,7 +88,17 @@ public:
         length(0), offset(0), parent(nullptr), next_(nullptr), previous_(nullptr), cclass(nullptr),
         flags(0), sub_section(nullptr), dirty(0), same(nullptr), loop(0), vvalue(nullptr),
         set(nullptr), parent_as_attribute(nullptr) {}
-    virtual ~grib_accessor() {}
+    virtual ~grib_accessor()
+    {
+        all_names.release(context);
+        all_name_spaces.release(context);
+        attributes.release(context);
+    }
+
+    // Accessors are allocated from the arena of their handle
+    static void* operator new(size_t size, grib_handle* h);
+    static void operator delete(void* p, grib_handle* h);
+    static void operator delete(void* p);
 
     virtual void init_accessor(const long, grib_arguments*) = 0;
     virtual void dump(grib_dumper* f) = 0;
@@ -43,6 +120,7 @@ public:
     virtual int unpack_float_element(size_t i, float* v) = 0;
     virtual int unpack_double_element_set(const size_t* index_array, size_t len, double* val_array) = 0;
     virtual int unpack_float_element_set(const size_t* index_array, size_t len, float* val_array) = 0;
+    virtual int unpack_value_bounds(double* lo, double* hi, int* exact) = 0;
     virtual int unpack_string(char* v, size_t* len) = 0;
     virtual int unpack_string_array(char** v, size_t* len) = 0;
     virtual int unpack_long(long* v, size_t* len) = 0;
@@ -82,15 +160,15 @@ public:
     unsigned long flags;         /** < Various flags */
     grib_section* sub_section;
 
-    const char* all_names[MAX_ACCESSOR_NAMES]= {0,};       /** < name of the accessor */
-    const char* all_name_spaces[MAX_ACCESSOR_NAMES] = {0,}; /** < namespace to which the accessor belongs */
+    grib_accessor_names all_names;       /** < name of the accessor, then its aliases */
+    grib_accessor_names all_name_spaces; /** < namespace of each entry in all_names */
     int dirty;
 
     grib_accessor* same;        /** < accessors with the same name */
     long loop;                  /** < used in lists */
     grib_virtual_value* vvalue; /** < virtual value used when transient flag on **/
     const char* set;
-    grib_accessor* attributes[MAX_ACCESSOR_ATTRIBUTES] = {0,}; /** < attributes are accessors */
+    grib_accessor_attributes attributes; /** < attributes are accessors */
     grib_accessor* parent_as_attribute;
 };
 
@@ -103,7 +181,7 @@ public:
     grib_accessor_class(const char* name) : name(name){}
     virtual ~grib_accessor_class(){}
 
-    virtual grib_accessor* create_empty_accessor() = 0;
+    virtual grib_accessor* create_empty_accessor(grib_handle* h) = 0;
     virtual grib_section* sub_section(grib_accessor* a) = 0;
     virtual int get_native_type(grib_accessor*) = 0;
     virtual int pack_missing(grib_accessor*) = 0;
@@ -142,6 +220,7 @@ public:
     virtual int unpack_double_element_set(grib_accessor*, const size_t* index_array, size_t len, double* val_array) = 0;
     virtual int unpack_float_element_set(grib_accessor*, const size_t* index_array, size_t len, float* val_array) = 0;
     virtual int unpack_double_subarray(grib_accessor*, double* val, size_t start, size_t len) = 0;
+    virtual int unpack_value_bounds(grib_accessor*, double* lo, double* hi, int* exact) = 0;
     virtual int clear(grib_accessor*) = 0;
     virtual grib_accessor* make_clone(grib_accessor*, grib_section*, int*) = 0;
 };
@@ -23,7 +23,7 @@ class grib_accessor_class_ascii_t : public grib_accessor_class_gen_t
 {
 public:
     grib_accessor_class_ascii_t(const char* name) : grib_accessor_class_gen_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_ascii_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_ascii_t{}; }
     int get_native_type(grib_accessor*) override;
     int pack_double(grib_accessor*, const double* val, size_t* len) override;
     int pack_long(grib_accessor*, const long* val, size_t* len) override;
@@ -190,6 +190,7 @@ void grib_accessor_class_bufr_data_array_t::init(grib_accessor* a, const long v,
     self->expanded                       = 0;
     self->expandedAccessor               = 0;
     self->dataAccessorsTrie              = 0;
+    self->keysSnapshot                   = 0;
     self->change_ref_value_operand       = 0;    /* Operator 203YYY: 0, 255 or YYY */
     self->refValListSize                 = 0;    /* Operator 203YYY: size of overridden reference values array */
     self->refValList                     = NULL; /* Operator 203YYY: overridden reference values array */
@@ -306,6 +307,88 @@ grib_trie_with_rank* accessor_bufr_data_array_get_dataAccessorsTrie(grib_accesso
     return self->dataAccessorsTrie;
 }
 
+static int compare_snapshot_names(const void* a, const void* b)
+{
+    return strcmp(*(const char* const*)a, *(const char* const*)b);
+}
+
+/* Index of name in the table of names of the snapshot, -1 if not there */
+long bufr_keys_snapshot_name_index(const bufr_keys_snapshot* s, const char* name)
+{
+    size_t lo = 0, hi = s->nnames;
+    while (lo < hi) {
+        const size_t mid = lo + (hi - lo) / 2;
+        const int r      = strcmp(s->names[mid], name);
+        if (r == 0)
+            return (long)mid;
+        if (r < 0)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return -1;
+}
+
+static void keys_snapshot_delete(grib_context* c, bufr_keys_snapshot* s)
+{
+    if (!s) return;
+    grib_context_free(c, s->entries);
+    grib_context_free(c, s->names);
+    grib_context_free(c, s);
+}
+
+static bufr_keys_snapshot* keys_snapshot_new(grib_context* c, grib_accessors_list* al)
+{
+    bufr_keys_snapshot* s = (bufr_keys_snapshot*)grib_context_malloc_clear(c, sizeof(bufr_keys_snapshot));
+    grib_accessors_list* l;
+    size_t n = 0, i, j;
+
+    if (!s) return NULL;
+    for (l = al; l; l = l->next_)
+        if (l->accessor) n++;
+    if (n == 0) return s;
+
+    s->entries = (bufr_keys_snapshot_entry*)grib_context_malloc(c, n * sizeof(bufr_keys_snapshot_entry));
+    s->names   = (const char**)grib_context_malloc(c, n * sizeof(char*));
+    if (!s->entries || !s->names) {
+        keys_snapshot_delete(c, s);
+        return NULL;
+    }
+
+    /* The first occurrence of each name has rank 1 */
+    for (l = al; l; l = l->next_) {
+        if (!l->accessor) continue;
+        s->entries[s->n++].accessor = l->accessor;
+        if (l->rank() == 1)
+            s->names[s->nnames++] = l->accessor->name;
+    }
+    qsort(s->names, s->nnames, sizeof(char*), compare_snapshot_names);
+    for (i = 0, j = 0; i < s->nnames; i++)
+        if (j == 0 || strcmp(s->names[i], s->names[j - 1]) != 0)
+            s->names[j++] = s->names[i];
+    s->nnames = j;
+
+    for (i = 0; i < s->n; i++) {
+        const long idx = bufr_keys_snapshot_name_index(s, s->entries[i].accessor->name);
+        if (idx < 0) {
+            keys_snapshot_delete(c, s);
+            return NULL;
+        }
+        s->entries[i].name_index = idx;
+    }
+
+    return s;
+}
+
+/* The snapshot is built on first use and dropped whenever the keys are created again */
+const bufr_keys_snapshot* accessor_bufr_data_array_get_keys_snapshot(grib_accessor* a)
+{
+    grib_accessor_bufr_data_array_t* self = (grib_accessor_bufr_data_array_t*)a;
+    if (!self->keysSnapshot && self->dataAccessors)
+        self->keysSnapshot = keys_snapshot_new(a->context, self->dataAccessors);
+    return self->keysSnapshot;
+}
+
 void accessor_bufr_data_array_set_unpackMode(grib_accessor* a, int unpackMode)
 {
     grib_accessor_bufr_data_array_t* self = (grib_accessor_bufr_data_array_t*)a;
@@ -2261,6 +2344,9 @@ static int create_keys(const grib_accessor* a, long onlySubset, long startSubset
     }
     self->dataAccessors = grib_accessors_list_create(c);
 
+    keys_snapshot_delete(c, self->keysSnapshot);
+    self->keysSnapshot = NULL;
+
     if (self->dataAccessorsTrie) {
         /* ECC-989: do not call grib_trie_with_rank_delete */
         grib_trie_with_rank_delete_container(self->dataAccessorsTrie);
@@ -3255,6 +3341,8 @@ void grib_accessor_class_bufr_data_array_t::destroy(grib_context* c, grib_access
     self_clear(c, self);
     if (self->dataAccessors)
         grib_accessors_list_delete(c, self->dataAccessors);
+    keys_snapshot_delete(c, self->keysSnapshot);
+    self->keysSnapshot = NULL;
     if (self->dataAccessorsTrie) {
         grib_trie_with_rank_delete_container(self->dataAccessorsTrie);
         self->dataAccessorsTrie = NULL;
@@ -54,6 +54,7 @@ public:
     int iInputShortReplications;
     grib_iarray* iss_list;
     grib_trie_with_rank* dataAccessorsTrie;
+    bufr_keys_snapshot* keysSnapshot;
     grib_sarray* tempStrings;
     grib_vdarray* tempDoubleValues;
     int change_ref_value_operand;
@@ -68,7 +69,7 @@ class grib_accessor_class_bufr_data_array_t : public grib_accessor_class_gen_t
 {
 public:
     grib_accessor_class_bufr_data_array_t(const char* name) : grib_accessor_class_gen_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_bufr_data_array_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_bufr_data_array_t{}; }
     int get_native_type(grib_accessor*) override;
     int pack_double(grib_accessor*, const double* val, size_t* len) override;
     int pack_long(grib_accessor*, const long* val, size_t* len) override;
@@ -85,5 +86,7 @@ public:
 grib_vsarray* accessor_bufr_data_array_get_stringValues(grib_accessor* a);
 grib_accessors_list* accessor_bufr_data_array_get_dataAccessors(grib_accessor* a);
 grib_trie_with_rank* accessor_bufr_data_array_get_dataAccessorsTrie(grib_accessor* a);
+const bufr_keys_snapshot* accessor_bufr_data_array_get_keys_snapshot(grib_accessor* a);
+long bufr_keys_snapshot_name_index(const bufr_keys_snapshot* s, const char* name);
 void accessor_bufr_data_array_set_unpackMode(grib_accessor* a, int unpackMode);
 
@@ -510,7 +510,7 @@ void grib_accessor_class_bufr_data_element_t::destroy(grib_context* ct, grib_acc
         /*grib_context_log(ct,GRIB_LOG_DEBUG,"deleting attribute %s->%s",a->name,a->attributes[i]->name);*/
         /*printf("bufr_data_element destroy %s %p\n", a->attributes[i]->name, (void*)a->attributes[i]);*/
         a->attributes[i]->destroy(ct);
-        a->attributes[i] = NULL;
+        a->attributes.set(ct, i, NULL);
         i++;
     }
     grib_accessor_class_gen_t::destroy(ct, a);
@@ -33,7 +33,7 @@ class grib_accessor_class_bufr_data_element_t : public grib_accessor_class_gen_t
 {
 public:
     grib_accessor_class_bufr_data_element_t(const char* name) : grib_accessor_class_gen_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_bufr_data_element_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_bufr_data_element_t{}; }
     int get_native_type(grib_accessor*) override;
     int pack_missing(grib_accessor*) override;
     int is_missing(grib_accessor*) override;
@@ -64,7 +64,7 @@ static int select_area(grib_accessor* a)
     size_t n;
     double lonWest, lonEast, latNorth, latSouth;
     long numberOfSubsets, i, latRank, lonRank;
-    grib_iarray* subsets = NULL;
+    long* subsets        = NULL;
     size_t nsubsets      = 0;
     char latstr[32]      = {0,};
     char lonstr[32] = {0,};
@@ -75,7 +75,7 @@ static int select_area(grib_accessor* a)
     ret = grib_get_long(h, self->numberOfSubsets, &numberOfSubsets);
     if (ret) return ret;
 
-    subsets = grib_iarray_new(c, numberOfSubsets, 10);
+    subsets = (long*)grib_context_malloc(c, sizeof(long) * numberOfSubsets);
 
     ret = grib_set_long(h, "unpack", 1);
     if (ret) return ret;
@@ -104,15 +104,8 @@ static int select_area(grib_accessor* a)
         }
     }
     else {
-        size_t values_len = 0;
-        for (i = 0; i < numberOfSubsets; ++i) {
-            snprintf(latstr, sizeof(latstr), "#%ld#latitude", i + 1);
-            ret = grib_get_size(h, latstr, &values_len);
-            if (ret) return ret;
-            if (values_len > 1) return GRIB_NOT_IMPLEMENTED;
-            ret = grib_get_double(h, latstr, &(lat[i]));
-            if (ret) return ret;
-        }
+        ret = bufr_get_subsets_double_array(h, "latitude", lat, numberOfSubsets);
+        if (ret) return ret;
     }
 
     /* Longitudes */
@@ -130,15 +123,8 @@ static int select_area(grib_accessor* a)
         }
     }
     else {
-        size_t values_len = 0;
-        for (i = 0; i < numberOfSubsets; ++i) {
-            snprintf(lonstr, sizeof(lonstr), "#%ld#longitude", i + 1);
-            ret = grib_get_size(h, lonstr, &values_len);
-            if (ret) return ret;
-            if (values_len > 1) return GRIB_NOT_IMPLEMENTED;
-            ret = grib_get_double(h, lonstr, &(lon[i]));
-            if (ret) return ret;
-        }
+        ret = bufr_get_subsets_double_array(h, "longitude", lon, numberOfSubsets);
+        if (ret) return ret;
     }
 
     ret = grib_get_double(h, self->extractAreaWestLongitude, &lonWest);
@@ -150,22 +136,17 @@ static int select_area(grib_accessor* a)
     ret = grib_get_double(h, self->extractAreaSouthLatitude, &latSouth);
     if (ret) return ret;
 
+    /* No branches: the subset number is always stored and only kept if inside the area */
     for (i = 0; i < numberOfSubsets; i++) {
-        /* printf("++++++ lat: %g <= %g <= %g lon: %g <= %g <= %g \n",latSouth,lat[i],latNorth,lonWest,lon[i],lonEast); */
-        if (lat[i] >= latSouth && lat[i] <= latNorth && lon[i] >= lonWest && lon[i] <= lonEast) {
-            grib_iarray_push(subsets, i + 1);
-            /* printf("++++++++ %ld\n",i+1); */
-        }
+        subsets[nsubsets] = i + 1;
+        nsubsets += (lat[i] >= latSouth) & (lat[i] <= latNorth) & (lon[i] >= lonWest) & (lon[i] <= lonEast);
     }
 
-    nsubsets = grib_iarray_used_size(subsets);
-    ret      = grib_set_long(h, self->extractedAreaNumberOfSubsets, nsubsets);
+    ret = grib_set_long(h, self->extractedAreaNumberOfSubsets, nsubsets);
     if (ret) return ret;
 
     if (nsubsets != 0) {
-        long* subsets_ar = grib_iarray_get_array(subsets);
-        ret              = grib_set_long_array(h, self->extractSubsetList, subsets_ar, nsubsets);
-        grib_context_free(c, subsets_ar);
+        ret = grib_set_long_array(h, self->extractSubsetList, subsets, nsubsets);
         if (ret) return ret;
 
         ret = grib_set_long(h, self->doExtractSubsets, 1);
@@ -174,8 +155,7 @@ static int select_area(grib_accessor* a)
 
     grib_context_free(c, lat);
     grib_context_free(c, lon);
-    grib_iarray_delete(subsets);
-    subsets = NULL;
+    grib_context_free(c, subsets);
 
     return ret;
 }
@@ -33,7 +33,7 @@ class grib_accessor_class_bufr_extract_area_subsets_t : public grib_accessor_cla
 {
 public:
     grib_accessor_class_bufr_extract_area_subsets_t(const char* name) : grib_accessor_class_gen_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_bufr_extract_area_subsets_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_bufr_extract_area_subsets_t{}; }
     int get_native_type(grib_accessor*) override;
     int pack_long(grib_accessor*, const long* val, size_t* len) override;
     void init(grib_accessor*, const long, grib_arguments*) override;
@@ -87,24 +87,8 @@ static int build_long_array(grib_context* c, grib_handle* h, int compressed,
         }
     }
     else {
-        /* uncompressed */
-        char keystr[32] = {
-            0,
-        };
-        size_t values_len = 0;
-        for (i = 0; i < numberOfSubsets; ++i) {
-            long lVal = 0;
-            snprintf(keystr, sizeof(keystr), "#%ld#%s", i + 1, key);
-            err = grib_get_size(h, keystr, &values_len);
-            if (err)
-                return err;
-            if (values_len > 1)
-                return GRIB_NOT_IMPLEMENTED;
-            err = grib_get_long(h, keystr, &lVal);
-            if (err)
-                return err;
-            (*array)[i] = lVal;
-        }
+        /* uncompressed: #1#key, #2#key, ... */
+        err = bufr_get_subsets_long_array(h, key, *array, numberOfSubsets);
     }
     return err;
 }
@@ -133,7 +117,7 @@ static int select_datetime(grib_accessor* a)
     long *year = NULL, *month = NULL, *day = NULL, *hour = NULL, *minute = NULL;
     double* second = NULL;
     long numberOfSubsets, i;
-    grib_iarray* subsets = NULL;
+    long* subsets        = NULL;
     size_t nsubsets      = 0;
     char yearstr[32]     = "year";
     char monthstr[32]    = "month";
@@ -148,7 +132,7 @@ static int select_datetime(grib_accessor* a)
     ret = grib_get_long(h, self->numberOfSubsets, &numberOfSubsets);
     if (ret) return ret;
 
-    subsets = grib_iarray_new(c, numberOfSubsets, 10);
+    subsets = (long*)grib_context_malloc(c, sizeof(long) * numberOfSubsets);
 
     ret = grib_set_long(h, "unpack", 1);
     if (ret) return ret;
@@ -221,23 +205,23 @@ static int select_datetime(grib_accessor* a)
     }
     else {
         /* uncompressed */
-        size_t values_len = 0;
-        for (i = 0; i < numberOfSubsets; ++i) {
-            snprintf(secondstr, sizeof(secondstr), "#%ld#second", i + 1);
-            ret = grib_get_size(h, secondstr, &values_len);
-            if (ret) {
-                /* no 'second' key */
-                for (i = 1; i < numberOfSubsets; i++)
-                    second[i] = second[0];
-            }
-            else {
+        ret = bufr_get_subsets_double_array(h, "second", second, numberOfSubsets);
+        if (ret == GRIB_NOT_FOUND) {
+            /* no 'second' key in some subset: all take the second of the first one (0 if it has none) */
+            size_t values_len = 0;
+            second[0]         = 0;
+            if (grib_get_size(h, "#1#second", &values_len) == GRIB_SUCCESS) {
                 if (values_len > 1)
                     return GRIB_NOT_IMPLEMENTED;
-                ret = grib_get_double(h, secondstr, &(second[i]));
+                ret = grib_get_double(h, "#1#second", &(second[0]));
                 if (ret)
                     return ret;
             }
+            for (i = 1; i < numberOfSubsets; i++)
+                second[i] = second[0];
+            ret = 0;
         }
+        if (ret) return ret;
     }
 
     ret = grib_get_long(h, "extractDateTimeYearStart", &yearStart);
@@ -310,23 +294,15 @@ static int select_datetime(grib_accessor* a)
         }
 
         /*printf("SN: datetime_str=%s j=%.15f\t", datetime_str, julianDT);*/
-        if (julianDT >= julianStart && julianEnd >= julianDT) {
-            /*printf(" ....ADDING subset %ld\n",i);*/
-            grib_iarray_push(subsets, i + 1);
-        }
-        else {
-            /*printf(" ....Exclude subset %ld\n",i);*/
-        }
+        subsets[nsubsets] = i + 1;
+        nsubsets += (julianDT >= julianStart) & (julianEnd >= julianDT);
     }
 
-    nsubsets = grib_iarray_used_size(subsets);
-    ret      = grib_set_long(h, "extractedDateTimeNumberOfSubsets", nsubsets);
+    ret = grib_set_long(h, "extractedDateTimeNumberOfSubsets", nsubsets);
     if (ret) return ret;
 
     if (nsubsets != 0) {
-        long* subsets_ar = grib_iarray_get_array(subsets);
-        ret              = grib_set_long_array(h, self->extractSubsetList, subsets_ar, nsubsets);
-        grib_context_free(c, subsets_ar);
+        ret = grib_set_long_array(h, self->extractSubsetList, subsets, nsubsets);
         if (ret) return ret;
 
         ret = grib_set_long(h, self->doExtractSubsets, 1);
@@ -340,8 +316,7 @@ cleanup:
     grib_context_free(c, hour);
     grib_context_free(c, minute);
     grib_context_free(c, second);
-    grib_iarray_delete(subsets);
-    subsets = NULL;
+    grib_context_free(c, subsets);
 
     return ret;
 }
@@ -0,0 +1,264 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+#include "grib_accessor_class_bufr_grid_box_thinning.h"
+#include <float.h>
+
+grib_accessor_class_bufr_grid_box_thinning_t _grib_accessor_class_bufr_grid_box_thinning{ "bufr_grid_box_thinning" };
+grib_accessor_class* grib_accessor_class_bufr_grid_box_thinning = &_grib_accessor_class_bufr_grid_box_thinning;
+
+
+void grib_accessor_class_bufr_grid_box_thinning_t::init(grib_accessor* a, const long len, grib_arguments* arg)
+{
+    grib_accessor_class_gen_t::init(a, len, arg);
+    grib_accessor_bufr_grid_box_thinning_t* self = (grib_accessor_bufr_grid_box_thinning_t*)a;
+    grib_handle* h                               = grib_handle_of_accessor(a);
+    int n                                        = 0;
+
+    a->length                    = 0;
+    self->doExtractSubsets       = grib_arguments_get_name(h, arg, n++);
+    self->numberOfSubsets        = grib_arguments_get_name(h, arg, n++);
+    self->extractSubsetList      = grib_arguments_get_name(h, arg, n++);
+    self->latitudeIncrement      = grib_arguments_get_name(h, arg, n++);
+    self->longitudeIncrement     = grib_arguments_get_name(h, arg, n++);
+    self->timeIncrement          = grib_arguments_get_name(h, arg, n++);
+    self->priorityKey            = grib_arguments_get_name(h, arg, n++);
+    self->priorityOrder          = grib_arguments_get_name(h, arg, n++);
+    self->thinnedNumberOfSubsets = grib_arguments_get_name(h, arg, n++);
+
+    a->flags |= GRIB_ACCESSOR_FLAG_FUNCTION;
+}
+
+int grib_accessor_class_bufr_grid_box_thinning_t::get_native_type(grib_accessor* a)
+{
+    return GRIB_TYPE_LONG;
+}
+
+/* One box of the grid (and time bucket) with the best subset found in it so far */
+typedef struct grid_box
+{
+    long ilat, ilon, itime;
+    long subset; /* -1 if the box is empty */
+    double score;
+} grid_box;
+
+static size_t grid_box_hash(long ilat, long ilon, long itime)
+{
+    uint64_t x = (uint64_t)ilat * 0x9E3779B97F4A7C15ULL;
+    x ^= (uint64_t)ilon + 0x7F4A7C159E3779B9ULL + (x << 6) + (x >> 2);
+    x ^= (uint64_t)itime * 0xC2B2AE3D27D4EB4FULL + (x << 6) + (x >> 2);
+    return (size_t)(x ^ (x >> 29));
+}
+
+/* Days since 1970-01-01 of a date in the proleptic Gregorian calendar */
+static long days_from_civil(long y, long m, long d)
+{
+    long era, yoe, doy, doe;
+    y -= m <= 2;
+    era = (y >= 0 ? y : y - 399) / 400;
+    yoe = y - era * 400;
+    doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+/* The value of key in each subset: #1#key for compressed data, #i#key of subset i otherwise */
+static int get_subsets_column(grib_handle* h, long compressed, const char* key, double* values, long numberOfSubsets)
+{
+    if (compressed) {
+        char name[256] = {0,};
+        size_t n       = numberOfSubsets;
+        long i;
+        int err;
+        snprintf(name, sizeof(name), "#1#%s", key);
+        err = grib_get_double_array(h, name, values, &n);
+        if (err) return err;
+        if (n == 1) {
+            /* All subsets have the same value */
+            for (i = 1; i < numberOfSubsets; i++)
+                values[i] = values[0];
+        }
+        else if (n != (size_t)numberOfSubsets) {
+            return GRIB_INTERNAL_ERROR;
+        }
+        return GRIB_SUCCESS;
+    }
+    return bufr_get_subsets_double_array(h, key, values, numberOfSubsets);
+}
+
+/* Keep one subset per latitude/longitude box and time bucket: the nearest to the centre
+ * of the box, or the one with the highest (or lowest) value of the priority key.
+ * The boxes are kept in a hash table so this is linear in the number of subsets */
+static int apply_thinning(grib_accessor* a)
+{
+    const grib_accessor_bufr_grid_box_thinning_t* self = (grib_accessor_bufr_grid_box_thinning_t*)a;
+
+    grib_handle* h  = grib_handle_of_accessor(a);
+    grib_context* c = h->context;
+    long compressed = 0, numberOfSubsets = 0, timeIncrement = 0, order = 1;
+    double dlat = 0, dlon = 0;
+    char priorityKey[256] = {0,};
+    size_t keylen             = sizeof(priorityKey);
+    double *lat = NULL, *lon = NULL, *priority = NULL;
+    double* times[5]           = {0,};
+    const char* time_keys[5]   = { "year", "month", "day", "hour", "minute" };
+    grid_box* boxes            = NULL;
+    unsigned char* keep        = NULL;
+    long* subsets              = NULL;
+    size_t nboxes = 1, nsubsets = 0, k;
+    long i;
+
+    int ret = grib_get_long(h, "compressedData", &compressed);
+    if (ret) return ret;
+    ret = grib_get_long(h, self->numberOfSubsets, &numberOfSubsets);
+    if (ret) return ret;
+    ret = grib_get_double(h, self->latitudeIncrement, &dlat);
+    if (ret) return ret;
+    ret = grib_get_double(h, self->longitudeIncrement, &dlon);
+    if (ret) return ret;
+    ret = grib_get_long(h, self->timeIncrement, &timeIncrement);
+    if (ret) return ret;
+    ret = grib_get_string(h, self->priorityKey, priorityKey, &keylen);
+    if (ret) return ret;
+    ret = grib_get_long(h, self->priorityOrder, &order);
+    if (ret) return ret;
+    if (dlat <= 0 || dlon <= 0 || timeIncrement < 0 || order == 0) {
+        grib_context_log(c, GRIB_LOG_ERROR, "%s: Invalid grid box thinning parameters", a->name);
+        return GRIB_INVALID_KEY_VALUE;
+    }
+
+    ret = grib_set_long(h, "unpack", 1);
+    if (ret) return ret;
+
+    lat = (double*)grib_context_malloc_clear(c, sizeof(double) * numberOfSubsets);
+    lon = (double*)grib_context_malloc_clear(c, sizeof(double) * numberOfSubsets);
+    ret = get_subsets_column(h, compressed, "latitude", lat, numberOfSubsets);
+    if (ret) goto cleanup;
+    ret = get_subsets_column(h, compressed, "longitude", lon, numberOfSubsets);
+    if (ret) goto cleanup;
+
+    if (priorityKey[0]) {
+        priority = (double*)grib_context_malloc_clear(c, sizeof(double) * numberOfSubsets);
+        ret      = get_subsets_column(h, compressed, priorityKey, priority, numberOfSubsets);
+        if (ret) {
+            grib_context_log(c, GRIB_LOG_ERROR, "%s: Unable to get priority key %s: %s",
+                             a->name, priorityKey, grib_get_error_message(ret));
+            goto cleanup;
+        }
+    }
+
+    if (timeIncrement > 0) {
+        for (k = 0; k < 5; k++) {
+            times[k] = (double*)grib_context_malloc_clear(c, sizeof(double) * numberOfSubsets);
+            ret      = get_subsets_column(h, compressed, time_keys[k], times[k], numberOfSubsets);
+            if (ret == GRIB_NOT_FOUND && k == 4)
+                ret = GRIB_SUCCESS; /* No minute: take zero */
+            if (ret) goto cleanup;
+        }
+    }
+
+    while (nboxes < 2 * (size_t)numberOfSubsets)
+        nboxes *= 2;
+    boxes = (grid_box*)grib_context_malloc(c, sizeof(grid_box) * nboxes);
+    for (k = 0; k < nboxes; k++)
+        boxes[k].subset = -1;
+
+    for (i = 0; i < numberOfSubsets; i++) {
+        long ilat, ilon, itime = 0;
+        double x, score;
+
+        if (lat[i] == GRIB_MISSING_DOUBLE || lon[i] == GRIB_MISSING_DOUBLE)
+            continue;
+        x = fmod(lon[i], 360.0);
+        if (x < 0) x += 360;
+        ilat = (long)floor((lat[i] + 90) / dlat);
+        ilon = (long)floor(x / dlon);
+
+        if (timeIncrement > 0) {
+            long minutes;
+            if (times[0][i] == GRIB_MISSING_DOUBLE || times[1][i] == GRIB_MISSING_DOUBLE ||
+                times[2][i] == GRIB_MISSING_DOUBLE || times[3][i] == GRIB_MISSING_DOUBLE ||
+                times[4][i] == GRIB_MISSING_DOUBLE)
+                continue;
+            minutes = days_from_civil((long)times[0][i], (long)times[1][i], (long)times[2][i]) * 1440 +
+                      (long)times[3][i] * 60 + (long)times[4][i];
+            itime   = (long)floor((double)minutes / timeIncrement);
+        }
+
+        if (priority) {
+            if (priority[i] == GRIB_MISSING_DOUBLE)
+                score = -DBL_MAX;
+            else
+                score = order > 0 ? priority[i] : -priority[i];
+        }
+        else {
+            const double clat = (ilat + 0.5) * dlat - 90;
+            const double dy   = lat[i] - clat;
+            const double dx   = (x - (ilon + 0.5) * dlon) * cos(clat * M_PI / 180);
+            score             = -(dx * dx + dy * dy);
+        }
+
+        k = grid_box_hash(ilat, ilon, itime) & (nboxes - 1);
+        while (boxes[k].subset >= 0 && !(boxes[k].ilat == ilat && boxes[k].ilon == ilon && boxes[k].itime == itime))
+            k = (k + 1) & (nboxes - 1);
+        if (boxes[k].subset < 0) {
+            boxes[k].ilat   = ilat;
+            boxes[k].ilon   = ilon;
+            boxes[k].itime  = itime;
+            boxes[k].subset = i;
+            boxes[k].score  = score;
+        }
+        else if (score > boxes[k].score) {
+            /* Ties go to the first subset */
+            boxes[k].subset = i;
+            boxes[k].score  = score;
+        }
+    }
+
+    /* The chosen subsets, in their original order */
+    keep = (unsigned char*)grib_context_malloc_clear(c, numberOfSubsets + 1);
+    for (k = 0; k < nboxes; k++)
+        if (boxes[k].subset >= 0)
+            keep[boxes[k].subset] = 1;
+    subsets = (long*)grib_context_malloc(c, sizeof(long) * (numberOfSubsets + 1));
+    for (i = 0; i < numberOfSubsets; i++) {
+        subsets[nsubsets] = i + 1;
+        nsubsets += keep[i];
+    }
+
+    ret = grib_set_long(h, self->thinnedNumberOfSubsets, nsubsets);
+    if (ret) goto cleanup;
+
+    if (nsubsets != 0) {
+        ret = grib_set_long_array(h, self->extractSubsetList, subsets, nsubsets);
+        if (ret) goto cleanup;
+
+        ret = grib_set_long(h, self->doExtractSubsets, 1);
+    }
+
+cleanup:
+    grib_context_free(c, lat);
+    grib_context_free(c, lon);
+    grib_context_free(c, priority);
+    for (k = 0; k < 5; k++)
+        grib_context_free(c, times[k]);
+    grib_context_free(c, boxes);
+    grib_context_free(c, keep);
+    grib_context_free(c, subsets);
+
+    return ret;
+}
+
+int grib_accessor_class_bufr_grid_box_thinning_t::pack_long(grib_accessor* a, const long* val, size_t* len)
+{
+    if (*len == 0)
+        return GRIB_SUCCESS;
+    return apply_thinning(a);
+}
@@ -23,7 +23,7 @@ class grib_accessor_class_bufr_group_t : public grib_accessor_class_variable_t
 {
 public:
     grib_accessor_class_bufr_group_t(const char* name) : grib_accessor_class_variable_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_bufr_group_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_bufr_group_t{}; }
     void dump(grib_accessor*, grib_dumper*) override;
     grib_accessor* next(grib_accessor* a, int explore) override;
 };
@@ -25,7 +25,7 @@ class grib_accessor_class_bufr_string_values_t : public grib_accessor_class_asci
 {
 public:
     grib_accessor_class_bufr_string_values_t(const char* name) : grib_accessor_class_ascii_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_bufr_string_values_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_bufr_string_values_t{}; }
     int unpack_string(grib_accessor*, char*, size_t* len) override;
     int unpack_string_array(grib_accessor*, char**, size_t* len) override;
     int value_count(grib_accessor*, long*) override;
@@ -25,7 +25,7 @@ class grib_accessor_class_bufrdc_expanded_descriptors_t : public grib_accessor_c
 {
 public:
     grib_accessor_class_bufrdc_expanded_descriptors_t(const char* name) : grib_accessor_class_long_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_bufrdc_expanded_descriptors_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_bufrdc_expanded_descriptors_t{}; }
     int unpack_long(grib_accessor*, long* val, size_t* len) override;
     int unpack_string_array(grib_accessor*, char**, size_t* len) override;
     int value_count(grib_accessor*, long*) override;
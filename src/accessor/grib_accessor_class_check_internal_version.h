@@ -23,7 +23,7 @@ class grib_accessor_class_check_internal_version_t : public grib_accessor_class_
 {
 public:
     grib_accessor_class_check_internal_version_t(const char* name) : grib_accessor_class_ascii_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_check_internal_version_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_check_internal_version_t{}; }
     size_t string_length(grib_accessor*) override;
     int value_count(grib_accessor*, long*) override;
     void init(grib_accessor*, const long, grib_arguments*) override;
@@ -0,0 +1,142 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+#include "grib_accessor_class_checksum.h"
+
+grib_accessor_class_checksum_t _grib_accessor_class_checksum{ "checksum" };
+grib_accessor_class* grib_accessor_class_checksum = &_grib_accessor_class_checksum;
+
+
+/* checksum(offset, length, "xxh3" or "crc32c", blocklisted1, blocklisted2, ...)
+ * Like md5 but with a fast non-cryptographic hash */
+void grib_accessor_class_checksum_t::init(grib_accessor* a, const long len, grib_arguments* arg)
+{
+    grib_accessor_class_gen_t::init(a, len, arg);
+    grib_accessor_checksum_t* self = (grib_accessor_checksum_t*)a;
+    grib_handle* h                 = grib_handle_of_accessor(a);
+    const char* type               = NULL;
+    char* b                        = 0;
+    int n                          = 0;
+    grib_string_list* current      = 0;
+    grib_context* context          = a->context;
+
+    self->offset    = grib_arguments_get_name(h, arg, n++);
+    self->length    = grib_arguments_get_expression(h, arg, n++);
+    type            = grib_arguments_get_string(h, arg, n++);
+    self->blocklist = NULL;
+    if (!type || grib_fingerprint_type_from_name(type, &self->type) != 0) {
+        grib_context_log(context, GRIB_LOG_FATAL, "%s: Unknown checksum type '%s' (use xxh3 or crc32c)",
+                         a->name, type ? type : "");
+    }
+    while ((b = (char*)grib_arguments_get_name(h, arg, n++)) != NULL) {
+        grib_string_list* item = (grib_string_list*)grib_context_malloc_clear(context, sizeof(grib_string_list));
+        item->value            = grib_context_strdup(context, b);
+        if (current)
+            current->next = item;
+        else
+            self->blocklist = item;
+        current = item;
+    }
+    a->length = 0;
+    a->flags |= GRIB_ACCESSOR_FLAG_READ_ONLY;
+    a->flags |= GRIB_ACCESSOR_FLAG_EDITION_SPECIFIC;
+}
+
+int grib_accessor_class_checksum_t::get_native_type(grib_accessor* a)
+{
+    return GRIB_TYPE_STRING;
+}
+
+int grib_accessor_class_checksum_t::compare(grib_accessor* a, grib_accessor* b)
+{
+    long acount = 0, bcount = 0;
+    int err     = a->value_count(&acount);
+    if (err)
+        return err;
+    err = b->value_count(&bcount);
+    if (err)
+        return err;
+    return acount == bcount ? GRIB_SUCCESS : GRIB_COUNT_MISMATCH;
+}
+
+int grib_accessor_class_checksum_t::unpack_string(grib_accessor* a, char* v, size_t* len)
+{
+    grib_accessor_checksum_t* self = (grib_accessor_checksum_t*)a;
+    grib_handle* h                 = grib_handle_of_accessor(a);
+    const size_t size              = self->type == GRIB_FINGERPRINT_CRC32C ? 9 : 17;
+    grib_string_list* blocklist    = NULL;
+    unsigned char* mess            = NULL;
+    long offset = 0, length = 0;
+    int ret     = GRIB_SUCCESS;
+
+    if (*len < size) {
+        grib_context_log(a->context, GRIB_LOG_ERROR,
+                         "%s: Buffer too small for %s. It is %zu bytes long (len=%zu)",
+                         a->cclass->name, a->name, size, *len);
+        *len = size;
+        return GRIB_BUFFER_TOO_SMALL;
+    }
+
+    if ((ret = grib_get_long_internal(h, self->offset, &offset)) != GRIB_SUCCESS)
+        return ret;
+    if ((ret = grib_expression_evaluate_long(h, self->length, &length)) != GRIB_SUCCESS)
+        return ret;
+    if (offset < 0 || length < 0 || (size_t)(offset + length) > h->buffer->ulength)
+        return GRIB_OUT_OF_RANGE;
+
+    /* As md5: the blocklist passed overrides the one of the context */
+    blocklist = self->blocklist ? self->blocklist : a->context->blocklist;
+    if (!blocklist || !blocklist->value) {
+        /* Nothing to blank out: hash the message in place */
+        grib_fingerprint(self->type, h->buffer->data + offset, length, v);
+        *len = strlen(v) + 1;
+        return GRIB_SUCCESS;
+    }
+
+    mess = (unsigned char*)grib_context_malloc(a->context, length);
+    if (!mess)
+        return GRIB_OUT_OF_MEMORY;
+    memcpy(mess, h->buffer->data + offset, length);
+    while (blocklist && blocklist->value) {
+        const grib_accessor* b = grib_find_accessor(h, blocklist->value);
+        if (!b) {
+            grib_context_free(a->context, mess);
+            return GRIB_NOT_FOUND;
+        }
+        if (b->offset >= offset && b->offset + b->length <= offset + length)
+            memset(mess + b->offset - offset, 0, b->length);
+        blocklist = blocklist->next;
+    }
+    grib_fingerprint(self->type, mess, length, v);
+    grib_context_free(a->context, mess);
+    *len = strlen(v) + 1;
+
+    return ret;
+}
+
+void grib_accessor_class_checksum_t::destroy(grib_context* c, grib_accessor* a)
+{
+    grib_accessor_checksum_t* self = (grib_accessor_checksum_t*)a;
+    grib_string_list* next         = self->blocklist;
+    while (next) {
+        grib_string_list* cur = next;
+        next                  = next->next;
+        grib_context_free(c, cur->value);
+        grib_context_free(c, cur);
+    }
+    self->blocklist = NULL;
+    grib_accessor_class_gen_t::destroy(c, a);
+}
+
+int grib_accessor_class_checksum_t::value_count(grib_accessor* a, long* count)
+{
+    *count = 1;
+    return 0;
+}
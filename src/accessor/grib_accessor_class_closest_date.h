@@ -32,7 +32,7 @@ class grib_accessor_class_closest_date_t : public grib_accessor_class_double_t
 {
 public:
     grib_accessor_class_closest_date_t(const char* name) : grib_accessor_class_double_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_closest_date_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_closest_date_t{}; }
     int unpack_double(grib_accessor*, double* val, size_t* len) override;
     int unpack_long(grib_accessor*, long* val, size_t* len) override;
     void dump(grib_accessor*, grib_dumper*) override;
@@ -24,7 +24,7 @@ class grib_accessor_class_codeflag_t : public grib_accessor_class_unsigned_t
 {
 public:
     grib_accessor_class_codeflag_t(const char* name) : grib_accessor_class_unsigned_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_codeflag_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_codeflag_t{}; }
     int value_count(grib_accessor*, long*) override;
     void dump(grib_accessor*, grib_dumper*) override;
     void init(grib_accessor*, const long, grib_arguments*) override;
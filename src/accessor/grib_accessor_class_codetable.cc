@@ -164,6 +164,27 @@ static void dump_codetable(grib_codetable* atable)
     }
 }
 #endif
+
+static grib_codetable* find_codetable(grib_codetable* next, const char* filename, const char* localFilename)
+{
+    while (next) {
+        if ((filename && next->filename[0] && grib_inline_strcmp(filename, next->filename[0]) == 0) &&
+            ((localFilename == 0 && next->filename[1] == NULL) ||
+             ((localFilename != 0 && next->filename[1] != NULL) && grib_inline_strcmp(localFilename, next->filename[1]) == 0))) {
+            return next;
+        }
+        /* Special case: see GRIB-735 */
+        if (filename == NULL && localFilename != NULL) {
+            if (str_eq(localFilename, next->filename[0]) ||
+                str_eq(localFilename, next->filename[1])) {
+                return next;
+            }
+        }
+        next = next->next;
+    }
+    return NULL;
+}
+
 static grib_codetable* load_table(grib_accessor* a)
 {
     grib_accessor_codetable_t* self = (grib_accessor_codetable_t*)a;
@@ -171,7 +192,6 @@ static grib_codetable* load_table(grib_accessor* a)
     grib_handle* h        = ((grib_accessor*)self)->parent->h;
     grib_context* c       = h->context;
     grib_codetable* t     = NULL;
-    grib_codetable* next  = NULL;
     char* filename        = 0;
     char recomposed[1024] = {0,};
     char localRecomposed[1024] = {0,};
@@ -205,32 +225,22 @@ static grib_codetable* load_table(grib_accessor* a)
         localFilename = grib_context_full_defs_path(c, localRecomposed);
     }
 
+    /*printf("DBG %s: Look in cache: f=%s lf=%s (recomposed=%s)\n", self->att.name, filename, localFilename,recomposed);*/
+    if (filename == NULL && localFilename == NULL)
+        return NULL;
+
+    /* Tables are only added to the cache once fully loaded so it can be searched without the lock */
+    t = find_codetable(c->codetable.load(std::memory_order_acquire), filename, localFilename);
+    if (t)
+        return t;
+
     GRIB_MUTEX_INIT_ONCE(&once, &thread_init);
     GRIB_MUTEX_LOCK(&mutex1); /* GRIB-930 */
 
-    /*printf("DBG %s: Look in cache: f=%s lf=%s (recomposed=%s)\n", self->att.name, filename, localFilename,recomposed);*/
-    if (filename == NULL && localFilename == NULL) {
-        t = NULL;
+    /* Another thread may have loaded it meanwhile */
+    t = find_codetable(c->codetable, filename, localFilename);
+    if (t)
         goto the_end;
-    }
-    next = c->codetable;
-    while (next) {
-        if ((filename && next->filename[0] && grib_inline_strcmp(filename, next->filename[0]) == 0) &&
-            ((localFilename == 0 && next->filename[1] == NULL) ||
-             ((localFilename != 0 && next->filename[1] != NULL) && grib_inline_strcmp(localFilename, next->filename[1]) == 0))) {
-            t = next;
-            goto the_end;
-        }
-        /* Special case: see GRIB-735 */
-        if (filename == NULL && localFilename != NULL) {
-            if (str_eq(localFilename, next->filename[0]) ||
-                str_eq(localFilename, next->filename[1])) {
-                t = next;
-                goto the_end;
-            }
-        }
-        next = next->next;
-    }
 
     if (a->flags & GRIB_ACCESSOR_FLAG_TRANSIENT) {
         Assert(a->vvalue != NULL);
@@ -259,6 +269,9 @@ static grib_codetable* load_table(grib_accessor* a)
         goto the_end;
     }
 
+    t->next = c->codetable;
+    c->codetable.store(t, std::memory_order_release);
+
 the_end:
     GRIB_MUTEX_UNLOCK(&mutex1);
 
@@ -282,9 +295,7 @@ static int grib_load_codetable(grib_context* c, const char* filename,
     if (t->filename[0] == NULL) {
         t->filename[0]        = grib_context_strdup_persistent(c, filename);
         t->recomposed_name[0] = grib_context_strdup_persistent(c, recomposed_name);
-        t->next               = c->codetable;
         t->size               = size;
-        c->codetable          = t;
     }
     else {
         t->filename[1]        = grib_context_strdup_persistent(c, filename);
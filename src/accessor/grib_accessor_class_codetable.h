@@ -26,7 +26,7 @@ public:
 class grib_accessor_class_codetable_t : public grib_accessor_class_unsigned_t
 {
 public:
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_codetable_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_codetable_t{}; }
     grib_accessor_class_codetable_t(const char* name) : grib_accessor_class_unsigned_t(name) {}
     int get_native_type(grib_accessor*) override;
     int pack_missing(grib_accessor*) override;
@@ -16,6 +16,6 @@ class grib_accessor_class_constant_t : public grib_accessor_class_variable_t
 {
 public:
     grib_accessor_class_constant_t(const char* name) : grib_accessor_class_variable_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_constant_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_constant_t{}; }
     void init(grib_accessor*, const long, grib_arguments*) override;
 };
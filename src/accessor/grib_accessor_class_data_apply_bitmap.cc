@@ -376,3 +376,12 @@ int grib_accessor_class_data_apply_bitmap_t::compare(grib_accessor* a, grib_acce
 
     return retval;
 }
+
+int grib_accessor_class_data_apply_bitmap_t::unpack_value_bounds(grib_accessor* a, double* lo, double* hi, int* exact)
+{
+    grib_accessor_data_apply_bitmap_t* self = (grib_accessor_data_apply_bitmap_t*)a;
+    grib_accessor* va = grib_find_accessor(grib_handle_of_accessor(a), self->coded_values);
+
+    /* Bounds of the coded (non-missing) values */
+    return va ? va->unpack_value_bounds(lo, hi, exact) : GRIB_NOT_FOUND;
+}
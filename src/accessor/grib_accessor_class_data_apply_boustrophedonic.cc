@@ -286,3 +286,12 @@ int grib_accessor_class_data_apply_boustrophedonic_t::get_native_type(grib_acces
 {
     return GRIB_TYPE_DOUBLE;
 }
+
+int grib_accessor_class_data_apply_boustrophedonic_t::unpack_value_bounds(grib_accessor* a, double* lo, double* hi, int* exact)
+{
+    grib_accessor_data_apply_boustrophedonic_t* self = (grib_accessor_data_apply_boustrophedonic_t*)a;
+    grib_accessor* va = grib_find_accessor(grib_handle_of_accessor(a), self->values);
+
+    /* Reordering the rows does not change the bounds */
+    return va ? va->unpack_value_bounds(lo, hi, exact) : GRIB_NOT_FOUND;
+}
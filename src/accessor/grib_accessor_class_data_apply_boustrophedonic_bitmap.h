@@ -29,7 +29,7 @@ class grib_accessor_class_data_apply_boustrophedonic_bitmap_t : public grib_acce
 {
 public:
     grib_accessor_class_data_apply_boustrophedonic_bitmap_t(const char* name) : grib_accessor_class_gen_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_data_apply_boustrophedonic_bitmap_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_data_apply_boustrophedonic_bitmap_t{}; }
     int get_native_type(grib_accessor*) override;
     int pack_double(grib_accessor*, const double* val, size_t* len) override;
     int unpack_double(grib_accessor*, double* val, size_t* len) override;
@@ -38,4 +38,5 @@ public:
     void init(grib_accessor*, const long, grib_arguments*) override;
     int unpack_double_element(grib_accessor*, size_t i, double* val) override;
     int unpack_double_element_set(grib_accessor*, const size_t* index_array, size_t len, double* val_array) override;
+    int unpack_value_bounds(grib_accessor*, double* lo, double* hi, int* exact) override;
 };
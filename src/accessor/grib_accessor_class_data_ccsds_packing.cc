@@ -80,6 +80,28 @@ static const char* aec_get_error_message(int code)
     return "Unknown error code";
 }
 
+// Values are (de)compressed through a bounded buffer of this many values so that
+// each chunk is scaled while it is still in cache
+#define CCSDS_CHUNK_SIZE 65536
+
+template <typename T, typename U>
+static void decode_chunk(const unsigned char* decoded, size_t n, double bscale, double reference_value, double dscale, T* val)
+{
+    const U* p = reinterpret_cast<const U*>(decoded);
+    for (size_t i = 0; i < n; i++) {
+        val[i] = (p[i] * bscale + reference_value) * dscale;
+    }
+}
+
+template <typename U>
+static void encode_chunk(const double* val, size_t n, double d, double reference_value, double divisor, unsigned char* encoded)
+{
+    U* p = reinterpret_cast<U*>(encoded);
+    for (size_t i = 0; i < n; i++) {
+        p[i] = static_cast<U>(((val[i] * d - reference_value) * divisor) + 0.5);
+    }
+}
+
 static void print_aec_stream_info(struct aec_stream* strm, const char* func)
 {
     fprintf(stderr, "ECCODES DEBUG CCSDS %s aec_stream.flags=%u\n", func, strm->flags);
@@ -103,6 +125,8 @@ int grib_accessor_class_data_ccsds_packing_t::pack_double(grib_accessor* a, cons
     unsigned char* buf     = NULL;
     unsigned char* encoded = NULL;
     size_t n_vals          = 0;
+    size_t chunk           = 0;
+    bool strm_inited       = false;
 
     long binary_scale_factor  = 0;
     long decimal_scale_factor = 0;
@@ -267,54 +291,22 @@ int grib_accessor_class_data_ccsds_packing_t::pack_double(grib_accessor* a, cons
     if (nbytes == 3)
         nbytes = 4;
 
-    encoded = reinterpret_cast<unsigned char*>(grib_context_buffer_malloc_clear(a->context, nbytes * n_vals));
+    if (nbytes != 1 && nbytes != 2 && nbytes != 4) {
+        grib_context_log(a->context, GRIB_LOG_ERROR, "%s pack_double: packing %s, bits_per_value=%ld (max 32)",
+                         cclass_name, a->name, bits_per_value);
+        err = GRIB_INVALID_BPV;
+        goto cleanup;
+    }
+
+    // The values are scaled chunk by chunk into a bounded buffer and fed to the encoder
+    chunk   = n_vals < CCSDS_CHUNK_SIZE ? n_vals : CCSDS_CHUNK_SIZE;
+    encoded = reinterpret_cast<unsigned char*>(grib_context_buffer_malloc_clear(a->context, nbytes * chunk));
 
     if (!encoded) {
         err = GRIB_OUT_OF_MEMORY;
         goto cleanup;
     }
 
-    /*
-    // Original code is memory efficient and supports 3 bytes per value
-    // replaced by ECC-1602 for performance reasons
-    buflen = 0;
-    p      = encoded;
-    for (i = 0; i < n_vals; i++) {
-        long blen                  = bits8;
-        unsigned long unsigned_val = (unsigned long)((((val[i] * d) - reference_value) * divisor) + 0.5);
-        while (blen >= 8) {
-            blen -= 8;
-            *p = (unsigned_val >> blen);
-            p++;
-            buflen++;
-        }
-    }
-    */
-
-    // ECC-1602: Performance improvement
-    switch (nbytes) {
-        case 1:
-            for (i = 0; i < n_vals; i++) {
-                encoded[i] = static_cast<uint8_t>(((val[i] * d - reference_value) * divisor) + 0.5);
-            }
-            break;
-        case 2:
-            for (i = 0; i < n_vals; i++) {
-                reinterpret_cast<uint16_t*>(encoded)[i] = static_cast<uint16_t>(((val[i] * d - reference_value) * divisor) + 0.5);
-            }
-            break;
-        case 4:
-            for (i = 0; i < n_vals; i++) {
-                reinterpret_cast<uint32_t*>(encoded)[i] = static_cast<uint32_t>(((val[i] * d - reference_value) * divisor) + 0.5);
-            }
-            break;
-        default:
-            grib_context_log(a->context, GRIB_LOG_ERROR, "%s pack_double: packing %s, bits_per_value=%ld (max 32)",
-                             cclass_name, a->name, bits_per_value);
-            err = GRIB_INVALID_BPV;
-            goto cleanup;
-    }
-
     grib_context_log(a->context, GRIB_LOG_DEBUG, "%s pack_double: packing %s, %zu values", cclass_name, a->name, n_vals);
 
     // ECC-1431: GRIB2: CCSDS encoding failure AEC_STREAM_ERROR
@@ -353,24 +345,51 @@ int grib_accessor_class_data_ccsds_packing_t::pack_double(grib_accessor* a, cons
     strm.next_out  = buf;
     strm.avail_out = buflen;
     strm.next_in   = encoded;
-    strm.avail_in  = nbytes * n_vals;
+    strm.avail_in  = 0;
 
     // This does not support spherical harmonics, and treats 24 differently than:
     // see http://cdo.sourcearchive.com/documentation/1.5.1.dfsg.1-1/cgribexlib_8c_source.html
 
     if (hand->context->debug) print_aec_stream_info(&strm, "pack_double");
 
-    if ((err = aec_buffer_encode(&strm)) != AEC_OK) {
-        grib_context_log(a->context, GRIB_LOG_ERROR, "%s %s: aec_buffer_encode error %d (%s)",
+    if ((err = aec_encode_init(&strm)) != AEC_OK) {
+        grib_context_log(a->context, GRIB_LOG_ERROR, "%s %s: aec_encode_init error %d (%s)",
                          cclass_name, __func__, err, aec_get_error_message(err));
         err = GRIB_ENCODING_ERROR;
         goto cleanup;
     }
+    strm_inited = true;
+
+    for (i = 0; i < n_vals; i += chunk) {
+        size_t n = (n_vals - i < chunk) ? n_vals - i : chunk;
+        // ECC-1602: Performance improvement
+        switch (nbytes) {
+            case 1:
+                encode_chunk<uint8_t>(val + i, n, d, reference_value, divisor, encoded);
+                break;
+            case 2:
+                encode_chunk<uint16_t>(val + i, n, d, reference_value, divisor, encoded);
+                break;
+            default:
+                encode_chunk<uint32_t>(val + i, n, d, reference_value, divisor, encoded);
+                break;
+        }
+        strm.next_in  = encoded;
+        strm.avail_in = nbytes * n;
+        if ((err = aec_encode(&strm, (i + n < n_vals) ? AEC_NO_FLUSH : AEC_FLUSH)) != AEC_OK || strm.avail_in != 0) {
+            grib_context_log(a->context, GRIB_LOG_ERROR, "%s %s: aec_encode error %d (%s)",
+                             cclass_name, __func__, err, aec_get_error_message(err));
+            err = GRIB_ENCODING_ERROR;
+            goto cleanup;
+        }
+    }
 
     buflen = strm.total_out;
     grib_buffer_replace(a, buf, buflen, 1, 1);
 
 cleanup:
+    if (strm_inited)
+        aec_encode_end(&strm);
     grib_context_buffer_free(a->context, buf);
     grib_context_buffer_free(a->context, encoded);
 
@@ -391,16 +410,17 @@ static int unpack(grib_accessor* a, T* val, size_t* len)
     grib_handle* hand = grib_handle_of_accessor(a);
     const char* cclass_name = a->cclass->name;
 
-    int err = GRIB_SUCCESS, i = 0;
+    int err = GRIB_SUCCESS;
+    size_t i = 0;
     size_t buflen = 0;
     struct aec_stream strm;
     double bscale          = 0;
     double dscale          = 0;
     unsigned char* buf     = NULL;
     size_t n_vals          = 0;
-    size_t size            = 0;
+    size_t chunk           = 0;
     unsigned char* decoded = NULL;
-    // unsigned char* p       = NULL;
+    bool strm_inited       = false;
     long nn = 0;
 
     long binary_scale_factor  = 0;
@@ -469,54 +489,71 @@ static int unpack(grib_accessor* a, T* val, size_t* len)
     if (nbytes == 3)
         nbytes = 4;
 
-    size    = n_vals * nbytes;
-    decoded = (unsigned char*)grib_context_buffer_malloc_clear(a->context, size);
+    if (nbytes != 1 && nbytes != 2 && nbytes != 4) {
+        grib_context_log(a->context, GRIB_LOG_ERROR, "%s %s: unpacking %s, bits_per_value=%ld (max 32)",
+                         cclass_name, __func__, a->name, bits_per_value);
+        return GRIB_INVALID_BPV;
+    }
+
+    // Decode through a bounded buffer and scale each chunk while it is hot
+    chunk   = n_vals < CCSDS_CHUNK_SIZE ? n_vals : CCSDS_CHUNK_SIZE;
+    decoded = (unsigned char*)grib_context_buffer_malloc(a->context, chunk * nbytes);
     if (!decoded) {
         err = GRIB_OUT_OF_MEMORY;
         goto cleanup;
     }
     strm.next_out  = decoded;
-    strm.avail_out = size;
+    strm.avail_out = chunk * nbytes;
 
     if (hand->context->debug) print_aec_stream_info(&strm, "unpack_*");
 
-    if ((err = aec_buffer_decode(&strm)) != AEC_OK) {
-        grib_context_log(a->context, GRIB_LOG_ERROR, "%s %s: aec_buffer_decode error %d (%s)",
+    if ((err = aec_decode_init(&strm)) != AEC_OK) {
+        grib_context_log(a->context, GRIB_LOG_ERROR, "%s %s: aec_decode_init error %d (%s)",
                          cclass_name, __func__, err, aec_get_error_message(err));
         err = GRIB_DECODING_ERROR;
         goto cleanup;
     }
-
-    // ECC-1427: Performance improvement (replaced by ECC-1602)
-    // grib_decode_array<T>(decoded, &pos, bits8 , reference_value, bscale, dscale, n_vals, val);
-
-    // ECC-1602: Performance improvement
-    switch (nbytes) {
-        case 1:
-            for (i = 0; i < n_vals; i++) {
-                val[i] = (reinterpret_cast<uint8_t*>(decoded)[i] * bscale + reference_value) * dscale;
-            }
-            break;
-        case 2:
-            for (i = 0; i < n_vals; i++) {
-                val[i] = (reinterpret_cast<uint16_t*>(decoded)[i] * bscale + reference_value) * dscale;
-            }
-            break;
-        case 4:
-            for (i = 0; i < n_vals; i++) {
-                val[i] = (reinterpret_cast<uint32_t*>(decoded)[i] * bscale + reference_value) * dscale;
-            }
-            break;
-        default:
-            grib_context_log(a->context, GRIB_LOG_ERROR, "%s %s: unpacking %s, bits_per_value=%ld (max 32)",
-                             cclass_name, __func__, a->name, bits_per_value);
-            err = GRIB_INVALID_BPV;
+    strm_inited = true;
+
+    for (i = 0; i < n_vals;) {
+        size_t n = (n_vals - i < chunk) ? n_vals - i : chunk;
+        strm.next_out  = decoded;
+        strm.avail_out = n * nbytes;
+        if ((err = aec_decode(&strm, AEC_FLUSH)) != AEC_OK) {
+            grib_context_log(a->context, GRIB_LOG_ERROR, "%s %s: aec_decode error %d (%s)",
+                             cclass_name, __func__, err, aec_get_error_message(err));
+            err = GRIB_DECODING_ERROR;
+            goto cleanup;
+        }
+        // The decoder only stops short when it runs out of input
+        n -= strm.avail_out / nbytes;
+        if (n == 0 || strm.avail_out % nbytes) {
+            grib_context_log(a->context, GRIB_LOG_ERROR, "%s %s: aec_decode: data ended after %zu of %zu values",
+                             cclass_name, __func__, i, n_vals);
+            err = GRIB_DECODING_ERROR;
             goto cleanup;
+        }
+
+        // ECC-1602: Performance improvement
+        switch (nbytes) {
+            case 1:
+                decode_chunk<T, uint8_t>(decoded, n, bscale, reference_value, dscale, val + i);
+                break;
+            case 2:
+                decode_chunk<T, uint16_t>(decoded, n, bscale, reference_value, dscale, val + i);
+                break;
+            default:
+                decode_chunk<T, uint32_t>(decoded, n, bscale, reference_value, dscale, val + i);
+                break;
+        }
+        i += n;
     }
 
     *len = n_vals;
 
 cleanup:
+    if (strm_inited)
+        aec_decode_end(&strm);
     grib_context_buffer_free(a->context, decoded);
     return err;
 }
@@ -650,3 +687,11 @@ int grib_accessor_class_data_ccsds_packing_t::unpack_double_element_set(grib_acc
 }
 
 #endif
+
+int grib_accessor_class_data_ccsds_packing_t::unpack_value_bounds(grib_accessor* a, double* lo, double* hi, int* exact)
+{
+    grib_accessor_data_ccsds_packing_t* self = (grib_accessor_data_ccsds_packing_t*)a;
+
+    return grib_get_packed_value_bounds(grib_handle_of_accessor(a), self->reference_value, self->binary_scale_factor,
+                                        self->decimal_scale_factor, self->bits_per_value, lo, hi, exact);
+}
@@ -10,6 +10,7 @@
  */
 
 #include "grib_accessor_class_data_complex_packing.h"
+#include "grib_bits_any_endian_simple.h"
 
 grib_accessor_class_data_complex_packing_t _grib_accessor_class_data_complex_packing{ "data_complex_packing" };
 grib_accessor_class* grib_accessor_class_data_complex_packing = &_grib_accessor_class_data_complex_packing;
@@ -184,6 +185,11 @@ int grib_accessor_class_data_complex_packing_t::pack_double(grib_accessor* a, co
     long mmax     = 0;
     long n_vals   = 0;
     double* scals = NULL;
+    const grib_laplacian_scaling* scaling = NULL;
+#if !FAST_BIG_ENDIAN
+    double* lvals = NULL; /* Scaled low resolution part, packed in one go */
+    size_t lcur   = 0;
+#endif
 
     double s = 0;
     double d = 0;
@@ -346,12 +352,12 @@ int grib_accessor_class_data_complex_packing_t::pack_double(grib_accessor* a, co
     lpos = 0;
     hpos = 0;
 
-    scals = (double*)grib_context_malloc(a->context, maxv * sizeof(double));
-    if (!scals) return GRIB_OUT_OF_MEMORY;
-
-    scals[0] = 0;
-    for (i = 1; i < maxv; i++)
-        scals[i] = ((double)pow(i * (i + 1), laplacianOperator));
+    scaling = grib_context_laplacian_scaling_get(a->context, maxv, laplacianOperator);
+    if (!scaling) {
+        grib_context_free(a->context, buf);
+        return GRIB_OUT_OF_MEMORY;
+    }
+    scals = scaling->pack;
 
     mmax   = 0;
     maxv   = pen_j + 1;
@@ -431,6 +437,15 @@ int grib_accessor_class_data_complex_packing_t::pack_double(grib_accessor* a, co
     }
     s = codes_power<double>(-binary_scale_factor, 2);
 
+#if !FAST_BIG_ENDIAN
+    lvals = (double*)grib_context_malloc(a->context, (n_vals - (sub_j + 1) * (sub_j + 2)) * sizeof(double));
+    if (!lvals) {
+        grib_context_free(a->context, buf);
+        grib_context_laplacian_scaling_release(a->context, scaling);
+        return GRIB_OUT_OF_MEMORY;
+    }
+#endif
+
     i = 0;
 
     mmax   = 0;
@@ -464,37 +479,17 @@ int grib_accessor_class_data_complex_packing_t::pack_double(grib_accessor* a, co
         grib_encode_double_array_complex((maxv - hcount) * 2, &(val[i]), bits_per_value, reference_value, &(scals[lup]), d, s, lres, &lpos);
         i += (maxv - hcount) * 2;
 #else
-        if (bits_per_value % 8) {
-            for (lcount = hcount; lcount < maxv; lcount++) {
-                current_val = (((((val[i++] * d) * scals[lup]) - reference_value) * s) + 0.5);
-                if (current_val < 0)
-                    grib_context_log(a->context, GRIB_LOG_ERROR,
-                                     "%s: negative coput before packing (%g)", cclass_name, current_val);
-                grib_encode_unsigned_longb(lres, current_val, &lpos, bits_per_value);
-
-                current_val = (((((val[i++] * d) * scals[lup]) - reference_value) * s) + 0.5);
-                if (current_val < 0)
-                    grib_context_log(a->context, GRIB_LOG_ERROR,
-                                     "%s: negative coput before packing (%g)", cclass_name, current_val);
-                grib_encode_unsigned_longb(lres, current_val, &lpos, bits_per_value);
-                lup++;
-            }
-        }
-        else {
-            for (lcount = hcount; lcount < maxv; lcount++) {
-                current_val = (((((val[i++] * d) * scals[lup]) - reference_value) * s) + 0.5);
-                if (current_val < 0)
-                    grib_context_log(a->context, GRIB_LOG_ERROR,
-                                     "%s: negative coput before packing (%g)", cclass_name, current_val);
-                grib_encode_unsigned_long(lres, current_val, &lpos, bits_per_value);
-
-                current_val = (((((val[i++] * d) * scals[lup]) - reference_value) * s) + 0.5);
+        for (lcount = hcount; lcount < maxv; lcount++) {
+            lvals[lcur] = (val[i++] * d) * scals[lup];
+            lvals[lcur + 1] = (val[i++] * d) * scals[lup];
+            if (lvals[lcur] < reference_value || lvals[lcur + 1] < reference_value) {
+                current_val = ((std::min(lvals[lcur], lvals[lcur + 1]) - reference_value) * s) + 0.5;
                 if (current_val < 0)
                     grib_context_log(a->context, GRIB_LOG_ERROR,
                                      "%s: negative coput before packing (%g)", cclass_name, current_val);
-                grib_encode_unsigned_long(lres, current_val, &lpos, bits_per_value);
-                lup++;
             }
+            lcur += 2;
+            lup++;
         }
 #endif
 
@@ -503,11 +498,17 @@ int grib_accessor_class_data_complex_packing_t::pack_double(grib_accessor* a, co
         mmax++;
     }
 
+#if !FAST_BIG_ENDIAN
+    /* Same rounding as value by value: ((x*1 - reference_value) * s) + 0.5 */
+    grib_encode_double_array(lcur, lvals, bits_per_value, reference_value, 1.0, s, lres, &lpos);
+    grib_context_free(a->context, lvals);
+#endif
+
     if (((hpos / 8) != hsize) && ((lpos / 8) != lsize)) {
         grib_context_log(a->context, GRIB_LOG_ERROR,
                          "%s: Mismatch in packing between high resolution and low resolution part", cclass_name);
         grib_context_free(a->context, buf);
-        grib_context_free(a->context, scals);
+        grib_context_laplacian_scaling_release(a->context, scaling);
         return GRIB_INTERNAL_ERROR;
     }
 
@@ -533,7 +534,7 @@ int grib_accessor_class_data_complex_packing_t::pack_double(grib_accessor* a, co
 
     grib_buffer_replace(a, buf, buflen, 1, 1);
     grib_context_free(a->context, buf);
-    grib_context_free(a->context, scals);
+    grib_context_laplacian_scaling_release(a->context, scaling);
 
     return ret;
 }
@@ -554,8 +555,15 @@ static int unpack_real(grib_accessor* a, T* val, size_t* len)
     long lup    = 0;
     long mmax   = 0;
     long n_vals = 0;
-    T* scals    = NULL;
-    T *pscals = NULL, *pval = NULL;
+    const double* scals = NULL;
+    double* pscals      = NULL;
+    T* pval             = NULL;
+    const T* tscals     = NULL; /* scals in the precision of the output */
+    T* fscals           = NULL;
+    const grib_laplacian_scaling* scaling = NULL;
+    long* hbits  = NULL; /* High resolution part as read from the bitstream */
+    size_t hsize = 0;
+    size_t hcur  = 0;
 
     T s                 = 0;
     T d                 = 0;
@@ -583,7 +591,6 @@ static int unpack_real(grib_accessor* a, T* val, size_t* len)
     long pen_k = 0;
     long pen_m = 0;
 
-    T operat = 0;
     int bytes;
     int err = 0;
     double tmp;
@@ -686,26 +693,57 @@ static int unpack_real(grib_accessor* a, T* val, size_t* len)
     s = codes_power<T>(binary_scale_factor, 2);
     d = codes_power<T>(-decimal_scale_factor, 10);
 
-    scals = (T*)grib_context_malloc(a->context, maxv * sizeof(T));
-    if (!scals) return GRIB_OUT_OF_MEMORY;
+    scaling = grib_context_laplacian_scaling_get(a->context, maxv, laplacianOperator);
+    if (!scaling) return GRIB_OUT_OF_MEMORY;
+    scals = scaling->unpack;
 
-    scals[0] = 0;
-    for (i = 1; i < maxv; i++) {
-        operat = pow(i * (i + 1), laplacianOperator);
-        if (operat != 0)
-            scals[i] = (1.0 / operat);
-        else {
-            grib_context_log(a->context, GRIB_LOG_WARNING,
-                             "%s: Problem with operator div by zero at index %d of %d", cclass_name, i, maxv);
-            scals[i] = 0;
+    if constexpr (std::is_same<T, double>::value) {
+        tscals = scals;
+    }
+    else {
+        /* Round the factors as they always were in single precision:
+         * the operator in T, then its inverse in T */
+        fscals = (T*)grib_context_malloc(a->context, maxv * sizeof(T));
+        if (!fscals) {
+            grib_context_laplacian_scaling_release(a->context, scaling);
+            return GRIB_OUT_OF_MEMORY;
         }
+        fscals[0] = 0;
+        for (i = 1; i < maxv; i++) {
+            T operat  = scaling->pack[i];
+            fscals[i] = operat != 0 ? (T)(1.0 / operat) : 0;
+        }
+        tscals = fscals;
     }
 
-    /*
-    printf("UNPACKING LAPLACE=%.20f\n",laplacianOperator);
-    printf("packed offset=%ld\n",packed_offset);
-    for(i=0;i<maxv;i++)
-        printf("scals[%d]=%g\n",i,scals[i]);*/
+    /* The high resolution (unscaled) part comes first in the buffer, then the
+     * packed part. Both are read in bulk and then interleaved row by row */
+    hsize = (sub_k + 1) * (sub_k + 2);
+    hbits = (long*)grib_context_malloc(a->context, hsize * sizeof(long));
+    if (!hbits) {
+        grib_context_free(a->context, fscals);
+        grib_context_laplacian_scaling_release(a->context, scaling);
+        return GRIB_OUT_OF_MEMORY;
+    }
+    grib_decode_long_array(hres, &hpos, 8 * bytes, hsize, hbits);
+
+#if !FAST_BIG_ENDIAN
+    {
+        /* Decode the packed values to the tail of val. When building the output
+         * we only ever write at or before the packed value being read */
+        T* packed      = val + hsize;
+        size_t npacked = n_vals - hsize;
+        long bitp      = 0;
+        if (bits_per_value == 0) {
+            for (i = 0; i < npacked; i++)
+                packed[i] = reference_value;
+        }
+        else {
+            grib_decode_array<T>(lres + lpos / 8, &bitp, bits_per_value, reference_value, s, 1.0, npacked, packed);
+        }
+    }
+    size_t lcur = hsize; /* Index of the next packed value in val */
+#endif
 
     i = 0;
 
@@ -713,20 +751,20 @@ static int unpack_real(grib_accessor* a, T* val, size_t* len)
         lup = mmax;
         if (sub_k >= 0) {
             for (hcount = 0; hcount < sub_k + 1; hcount++) {
-                val[i++] = decode_float(grib_decode_unsigned_long(hres, &hpos, 8 * bytes));
-                val[i++] = decode_float(grib_decode_unsigned_long(hres, &hpos, 8 * bytes));
+                val[i++] = decode_float(hbits[hcur++]);
+                val[i++] = decode_float(hbits[hcur++]);
 
                 if (GRIBEX_sh_bug_present && hcount == sub_k) {
                     /*  bug in ecmwf data, last row (K+1)is scaled but should not */
-                    val[i - 2] *= scals[lup];
-                    val[i - 1] *= scals[lup];
+                    val[i - 2] *= tscals[lup];
+                    val[i - 1] *= tscals[lup];
                 }
                 lup++;
             }
             sub_k--;
         }
 
-        pscals = scals + lup;
+        pscals = (double*)scals + lup;
         pval   = val + i;
 #if FAST_BIG_ENDIAN
         grib_decode_double_array_complex(lres,
@@ -737,8 +775,10 @@ static int unpack_real(grib_accessor* a, T* val, size_t* len)
         (void)pscals; /* suppress gcc warning */
         (void)pval;   /* suppress gcc warning */
         for (lcount = hcount; lcount < maxv; lcount++) {
-            val[i++] = d * (T)((grib_decode_unsigned_long(lres, &lpos, bits_per_value) * s) + reference_value) * scals[lup];
-            val[i++] = d * (T)((grib_decode_unsigned_long(lres, &lpos, bits_per_value) * s) + reference_value) * scals[lup];
+            T re = val[lcur++];
+            T im = val[lcur++];
+            val[i++] = d * re * tscals[lup];
+            val[i++] = d * im * tscals[lup];
             /* These values should always be zero, but as they are packed,
                it is necessary to force them back to zero */
             if (mmax == 0)
@@ -755,7 +795,9 @@ static int unpack_real(grib_accessor* a, T* val, size_t* len)
     Assert(*len >= i);
     *len = i;
 
-    grib_context_free(a->context, scals);
+    grib_context_free(a->context, hbits);
+    grib_context_free(a->context, fscals);
+    grib_context_laplacian_scaling_release(a->context, scaling);
 
     return ret;
 }
@@ -788,3 +830,9 @@ int grib_accessor_class_data_complex_packing_t::unpack_float(grib_accessor* a, f
 
     return GRIB_SUCCESS;
 }
+
+int grib_accessor_class_data_complex_packing_t::unpack_value_bounds(grib_accessor* a, double* lo, double* hi, int* exact)
+{
+    /* The packing parameters apply to the spectral coefficients, not to the values */
+    return GRIB_NOT_IMPLEMENTED;
+}
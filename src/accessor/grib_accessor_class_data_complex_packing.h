@@ -37,10 +37,11 @@ class grib_accessor_class_data_complex_packing_t : public grib_accessor_class_da
 {
 public:
     grib_accessor_class_data_complex_packing_t(const char* name) : grib_accessor_class_data_simple_packing_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_data_complex_packing_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_data_complex_packing_t{}; }
     int pack_double(grib_accessor*, const double* val, size_t* len) override;
     int unpack_double(grib_accessor*, double* val, size_t* len) override;
     int unpack_float(grib_accessor*, float* val, size_t* len) override;
     int value_count(grib_accessor*, long*) override;
     void init(grib_accessor*, const long, grib_arguments*) override;
+    int unpack_value_bounds(grib_accessor*, double* lo, double* hi, int* exact) override;
 };
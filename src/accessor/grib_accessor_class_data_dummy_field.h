@@ -25,7 +25,7 @@ class grib_accessor_class_data_dummy_field_t : public grib_accessor_class_data_g
 {
 public:
     grib_accessor_class_data_dummy_field_t(const char* name) : grib_accessor_class_data_g1simple_packing_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_data_dummy_field_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_data_dummy_field_t{}; }
     int pack_double(grib_accessor*, const double* val, size_t* len) override;
     int unpack_double(grib_accessor*, double* val, size_t* len) override;
     int value_count(grib_accessor*, long*) override;
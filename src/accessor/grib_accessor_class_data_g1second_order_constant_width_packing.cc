@@ -235,3 +235,10 @@ int grib_accessor_class_data_g1second_order_constant_width_packing_t::unpack_dou
     grib_context_free(a->context, values);
     return GRIB_SUCCESS;
 }
+
+int grib_accessor_class_data_g1second_order_constant_width_packing_t::unpack_value_bounds(grib_accessor* a, double* lo, double* hi, int* exact)
+{
+    /* Second-order values are group references plus second-order values of varying widths:
+       bitsPerValue alone does not bound them */
+    return GRIB_NOT_IMPLEMENTED;
+}
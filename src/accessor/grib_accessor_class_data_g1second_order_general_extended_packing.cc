@@ -1217,3 +1217,10 @@ void grib_accessor_class_data_g1second_order_general_extended_packing_t::destroy
     }
     grib_accessor_class_data_simple_packing_t::destroy(context, a);
 }
+
+int grib_accessor_class_data_g1second_order_general_extended_packing_t::unpack_value_bounds(grib_accessor* a, double* lo, double* hi, int* exact)
+{
+    /* Second-order values are group references plus second-order values of varying widths:
+       bitsPerValue alone does not bound them */
+    return GRIB_NOT_IMPLEMENTED;
+}
@@ -178,3 +178,10 @@ int grib_accessor_class_data_g1second_order_general_packing_t::pack_double(grib_
 
     return grib_set_double_array(hand, "values", cval, *len);
 }
+
+int grib_accessor_class_data_g1second_order_general_packing_t::unpack_value_bounds(grib_accessor* a, double* lo, double* hi, int* exact)
+{
+    /* Second-order values are group references plus second-order values of varying widths:
+       bitsPerValue alone does not bound them */
+    return GRIB_NOT_IMPLEMENTED;
+}
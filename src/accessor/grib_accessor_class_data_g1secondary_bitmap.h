@@ -23,7 +23,7 @@ class grib_accessor_class_data_g1secondary_bitmap_t : public grib_accessor_class
 {
 public:
     grib_accessor_class_data_g1secondary_bitmap_t(const char* name) : grib_accessor_class_data_secondary_bitmap_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_data_g1secondary_bitmap_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_data_g1secondary_bitmap_t{}; }
     int pack_double(grib_accessor*, const double* val, size_t* len) override;
     int value_count(grib_accessor*, long*) override;
     void init(grib_accessor*, const long, grib_arguments*) override;
@@ -771,3 +771,9 @@ cleanup:
 
     return ret;
 }
+
+int grib_accessor_class_data_g2bifourier_packing_t::unpack_value_bounds(grib_accessor* a, double* lo, double* hi, int* exact)
+{
+    /* The packing parameters apply to the spectral coefficients, not to the values */
+    return GRIB_NOT_IMPLEMENTED;
+}
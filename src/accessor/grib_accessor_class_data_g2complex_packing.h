@@ -23,7 +23,7 @@ class grib_accessor_class_data_g2complex_packing_t : public grib_accessor_class_
 {
 public:
     grib_accessor_class_data_g2complex_packing_t(const char* name) : grib_accessor_class_data_complex_packing_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_data_g2complex_packing_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_data_g2complex_packing_t{}; }
     int pack_double(grib_accessor*, const double* val, size_t* len) override;
     int value_count(grib_accessor*, long*) override;
     void init(grib_accessor*, const long, grib_arguments*) override;
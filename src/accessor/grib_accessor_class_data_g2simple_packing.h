@@ -18,7 +18,7 @@ class grib_accessor_class_data_g2simple_packing_t : public grib_accessor_class_d
 {
 public:
     grib_accessor_class_data_g2simple_packing_t(const char* name) : grib_accessor_class_data_simple_packing_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_data_g2simple_packing_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_data_g2simple_packing_t{}; }
     int pack_bytes(grib_accessor*, const unsigned char*, size_t* len) override;
     int pack_double(grib_accessor*, const double* val, size_t* len) override;
     int value_count(grib_accessor*, long*) override;
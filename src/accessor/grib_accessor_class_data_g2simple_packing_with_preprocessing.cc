@@ -173,3 +173,30 @@ int grib_accessor_class_data_g2simple_packing_with_preprocessing_t::pack_double(
 
     return GRIB_SUCCESS;
 }
+
+int grib_accessor_class_data_g2simple_packing_with_preprocessing_t::unpack_value_bounds(grib_accessor* a, double* lo, double* hi, int* exact)
+{
+    grib_accessor_data_g2simple_packing_with_preprocessing_t* self = (grib_accessor_data_g2simple_packing_with_preprocessing_t*)a;
+    grib_handle* gh = grib_handle_of_accessor(a);
+
+    long pre_processing;
+    double pre_processing_parameter;
+    double bounds[2];
+    int err = 0;
+
+    if ((err = grib_get_long_internal(gh, self->pre_processing, &pre_processing)) != GRIB_SUCCESS)
+        return err;
+    if ((err = grib_get_double_internal(gh, self->pre_processing_parameter, &pre_processing_parameter)) != GRIB_SUCCESS)
+        return err;
+
+    if ((err = grib_accessor_class_data_simple_packing_t::unpack_value_bounds(a, &bounds[0], &bounds[1], exact)) != GRIB_SUCCESS)
+        return err;
+
+    /* The inverse pre-processing is increasing so it maps the bounds onto the bounds */
+    if ((err = pre_processing_func(bounds, 2, pre_processing, &pre_processing_parameter, INVERSE)) != GRIB_SUCCESS)
+        return err;
+
+    *lo = bounds[0];
+    *hi = bounds[1];
+    return GRIB_SUCCESS;
+}
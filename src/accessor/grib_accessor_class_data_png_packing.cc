@@ -635,3 +635,11 @@ int grib_accessor_class_data_png_packing_t::unpack_double_element_set(grib_acces
 }
 
 #endif
+
+int grib_accessor_class_data_png_packing_t::unpack_value_bounds(grib_accessor* a, double* lo, double* hi, int* exact)
+{
+    grib_accessor_data_png_packing_t* self = (grib_accessor_data_png_packing_t*)a;
+
+    return grib_get_packed_value_bounds(grib_handle_of_accessor(a), self->reference_value, self->binary_scale_factor,
+                                        self->decimal_scale_factor, self->bits_per_value, lo, hi, exact);
+}
@@ -243,3 +243,9 @@ int grib_accessor_class_data_sh_packed_t::unpack_double(grib_accessor* a, double
 
     return ret;
 }
+
+int grib_accessor_class_data_sh_packed_t::unpack_value_bounds(grib_accessor* a, double* lo, double* hi, int* exact)
+{
+    /* The packing parameters apply to the spectral coefficients, not to the values */
+    return GRIB_NOT_IMPLEMENTED;
+}
@@ -234,3 +234,9 @@ int grib_accessor_class_data_sh_unpacked_t::unpack_double(grib_accessor* a, doub
 
     return ret;
 }
+
+int grib_accessor_class_data_sh_unpacked_t::unpack_value_bounds(grib_accessor* a, double* lo, double* hi, int* exact)
+{
+    /* The packing parameters apply to the spectral coefficients, not to the values */
+    return GRIB_NOT_IMPLEMENTED;
+}
@@ -69,6 +69,31 @@ int grib_accessor_class_data_simple_packing_t::value_count(grib_accessor* a, lon
     return grib_get_long_internal(grib_handle_of_accessor(a), self->number_of_values, number_of_values);
 }
 
+int grib_accessor_class_data_simple_packing_t::unpack_value_bounds(grib_accessor* a, double* lo, double* hi, int* exact)
+{
+    grib_accessor_data_simple_packing_t* self = (grib_accessor_data_simple_packing_t*)a;
+    grib_handle* gh = grib_handle_of_accessor(a);
+    double units_factor = 1.0;
+    double units_bias   = 0.0;
+
+    int err = grib_get_packed_value_bounds(gh, self->reference_value, self->binary_scale_factor,
+                                           self->decimal_scale_factor, self->bits_per_value, lo, hi, exact);
+    if (err || *exact)
+        return err; /* Constant fields are returned as is, see unpack_double */
+
+    if (self->units_factor)
+        grib_get_double_internal(gh, self->units_factor, &units_factor);
+    if (self->units_bias)
+        grib_get_double_internal(gh, self->units_bias, &units_bias);
+    if (units_factor != 1.0 || units_bias != 0.0) {
+        const double l = *lo * units_factor + units_bias;
+        const double h = *hi * units_factor + units_bias;
+        *lo = l < h ? l : h;
+        *hi = l < h ? h : l;
+    }
+    return GRIB_SUCCESS;
+}
+
 int grib_accessor_class_data_simple_packing_t::unpack_double_element(grib_accessor* a, size_t idx, double* val)
 {
     grib_accessor_data_simple_packing_t* self = (grib_accessor_data_simple_packing_t*)a;
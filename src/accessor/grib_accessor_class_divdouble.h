@@ -24,7 +24,7 @@ class grib_accessor_class_divdouble_t : public grib_accessor_class_double_t
 {
 public:
     grib_accessor_class_divdouble_t(const char* name) : grib_accessor_class_double_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_divdouble_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_divdouble_t{}; }
     int unpack_double(grib_accessor*, double* val, size_t* len) override;
     void init(grib_accessor*, const long, grib_arguments*) override;
 };
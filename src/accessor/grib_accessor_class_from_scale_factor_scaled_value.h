@@ -25,7 +25,7 @@ class grib_accessor_class_from_scale_factor_scaled_value_t : public grib_accesso
 {
 public:
     grib_accessor_class_from_scale_factor_scaled_value_t(const char* name) : grib_accessor_class_double_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_from_scale_factor_scaled_value_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_from_scale_factor_scaled_value_t{}; }
     int is_missing(grib_accessor*) override;
     int pack_double(grib_accessor*, const double* val, size_t* len) override;
     int unpack_double(grib_accessor*, double* val, size_t* len) override;
@@ -24,7 +24,7 @@ class grib_accessor_class_g1_section4_length_t : public grib_accessor_class_sect
 {
 public:
     grib_accessor_class_g1_section4_length_t(const char* name) : grib_accessor_class_section_length_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_g1_section4_length_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_g1_section4_length_t{}; }
     int pack_long(grib_accessor*, const long* val, size_t* len) override;
     int unpack_long(grib_accessor*, long* val, size_t* len) override;
     void init(grib_accessor*, const long, grib_arguments*) override;
@@ -24,7 +24,7 @@ class grib_accessor_class_g1bitmap_t : public grib_accessor_class_bitmap_t
 {
 public:
     grib_accessor_class_g1bitmap_t(const char* name) : grib_accessor_class_bitmap_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_g1bitmap_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_g1bitmap_t{}; }
     int pack_double(grib_accessor*, const double* val, size_t* len) override;
     int unpack_bytes(grib_accessor*, unsigned char*, size_t* len) override;
     int value_count(grib_accessor*, long*) override;
@@ -23,7 +23,7 @@ class grib_accessor_class_g1day_of_the_year_date_t : public grib_accessor_class_
 {
 public:
     grib_accessor_class_g1day_of_the_year_date_t(const char* name) : grib_accessor_class_g1date_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_g1day_of_the_year_date_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_g1day_of_the_year_date_t{}; }
     int unpack_string(grib_accessor*, char*, size_t* len) override;
     void dump(grib_accessor*, grib_dumper*) override;
     void init(grib_accessor*, const long, grib_arguments*) override;
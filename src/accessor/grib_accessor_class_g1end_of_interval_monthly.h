@@ -24,7 +24,7 @@ class grib_accessor_class_g1end_of_interval_monthly_t : public grib_accessor_cla
 {
 public:
     grib_accessor_class_g1end_of_interval_monthly_t(const char* name) : grib_accessor_class_abstract_vector_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_g1end_of_interval_monthly_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_g1end_of_interval_monthly_t{}; }
     int unpack_double(grib_accessor*, double* val, size_t* len) override;
     int value_count(grib_accessor*, long*) override;
     void destroy(grib_context*, grib_accessor*) override;
@@ -23,6 +23,6 @@ class grib_accessor_class_g1fcperiod_t : public grib_accessor_class_g1step_range
 {
 public:
     grib_accessor_class_g1fcperiod_t(const char* name) : grib_accessor_class_g1step_range_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_g1fcperiod_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_g1fcperiod_t{}; }
     int unpack_string(grib_accessor*, char*, size_t* len) override;
 };
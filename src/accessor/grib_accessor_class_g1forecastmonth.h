@@ -29,7 +29,7 @@ class grib_accessor_class_g1forecastmonth_t : public grib_accessor_class_long_t
 {
 public:
     grib_accessor_class_g1forecastmonth_t(const char* name) : grib_accessor_class_long_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_g1forecastmonth_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_g1forecastmonth_t{}; }
     int pack_long(grib_accessor*, const long* val, size_t* len) override;
     int unpack_long(grib_accessor*, long* val, size_t* len) override;
     void dump(grib_accessor*, grib_dumper*) override;
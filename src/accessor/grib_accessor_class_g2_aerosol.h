@@ -26,7 +26,7 @@ class grib_accessor_class_g2_aerosol_t : public grib_accessor_class_unsigned_t
 {
 public:
     grib_accessor_class_g2_aerosol_t(const char* name) : grib_accessor_class_unsigned_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_g2_aerosol_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_g2_aerosol_t{}; }
     int pack_long(grib_accessor*, const long* val, size_t* len) override;
     int unpack_long(grib_accessor*, long* val, size_t* len) override;
     int value_count(grib_accessor*, long*) override;
@@ -33,7 +33,7 @@ class grib_accessor_class_g2_mars_labeling_t : public grib_accessor_class_gen_t
 {
 public:
     grib_accessor_class_g2_mars_labeling_t(const char* name) : grib_accessor_class_gen_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_g2_mars_labeling_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_g2_mars_labeling_t{}; }
     int get_native_type(grib_accessor*) override;
     int pack_long(grib_accessor*, const long* val, size_t* len) override;
     int pack_string(grib_accessor*, const char*, size_t* len) override;
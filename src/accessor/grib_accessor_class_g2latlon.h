@@ -26,7 +26,7 @@ class grib_accessor_class_g2latlon_t : public grib_accessor_class_double_t
 {
 public:
     grib_accessor_class_g2latlon_t(const char* name) : grib_accessor_class_double_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_g2latlon_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_g2latlon_t{}; }
     int pack_missing(grib_accessor*) override;
     int is_missing(grib_accessor*) override;
     int pack_double(grib_accessor*, const double* val, size_t* len) override;
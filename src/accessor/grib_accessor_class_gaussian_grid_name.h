@@ -26,7 +26,7 @@ class grib_accessor_class_gaussian_grid_name_t : public grib_accessor_class_gen_
 {
 public:
     grib_accessor_class_gaussian_grid_name_t(const char* name) : grib_accessor_class_gen_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_gaussian_grid_name_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_gaussian_grid_name_t{}; }
     int get_native_type(grib_accessor*) override;
     int unpack_string(grib_accessor*, char*, size_t* len) override;
     size_t string_length(grib_accessor*) override;
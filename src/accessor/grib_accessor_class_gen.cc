@@ -98,6 +98,11 @@ int grib_accessor_gen_t::unpack_float_element(size_t i, float* v)
     return GRIB_NOT_IMPLEMENTED;
 }
 
+int grib_accessor_gen_t::unpack_value_bounds(double* lo, double* hi, int* exact)
+{
+    return cclass->unpack_value_bounds(this, lo, hi, exact);
+}
+
 int grib_accessor_gen_t::unpack_long(long* v, size_t* len)
 {
     return cclass->unpack_long(this, v, len);
@@ -714,6 +719,11 @@ int grib_accessor_class_gen_t::unpack_double_subarray(grib_accessor* a, double*
     return GRIB_NOT_IMPLEMENTED;
 }
 
+int grib_accessor_class_gen_t::unpack_value_bounds(grib_accessor* a, double* lo, double* hi, int* exact)
+{
+    return GRIB_NOT_IMPLEMENTED;
+}
+
 grib_accessor* grib_accessor_class_gen_t::make_clone(grib_accessor* a, grib_section* s, int* err)
 {
     *err = GRIB_NOT_IMPLEMENTED;
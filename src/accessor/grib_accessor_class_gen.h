@@ -35,6 +35,7 @@ class grib_accessor_gen_t : public grib_accessor {
     int unpack_float_element(size_t i, float* v) override;
     int unpack_double_element_set(const size_t* index_array, size_t len, double* val_array) override;
     int unpack_float_element_set(const size_t* index_array, size_t len, float* val_array) override;
+    int unpack_value_bounds(double* lo, double* hi, int* exact) override;
     int unpack_string(char* v, size_t* len) override;
     int unpack_string_array(char** v, size_t* len) override;
     int unpack_long(long* v, size_t* len) override;
@@ -60,7 +61,7 @@ public:
     grib_accessor_class_gen_t(const char* name) : grib_accessor_class{name} {}
     ~grib_accessor_class_gen_t();
 
-    grib_accessor* create_empty_accessor() override{ return new grib_accessor_gen_t(); }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_gen_t(); }
     grib_section* sub_section(grib_accessor* a) override;
     int get_native_type(grib_accessor*) override;
     int pack_missing(grib_accessor*) override;
@@ -99,6 +100,7 @@ public:
     int unpack_double_element_set(grib_accessor*, const size_t* index_array, size_t len, double* val_array) override;
     int unpack_float_element_set(grib_accessor*, const size_t* index_array, size_t len, float* val_array) override;
     int unpack_double_subarray(grib_accessor*, double* val, size_t start, size_t len) override;
+    int unpack_value_bounds(grib_accessor*, double* lo, double* hi, int* exact) override;
     int clear(grib_accessor*) override;
     grib_accessor* make_clone(grib_accessor*, grib_section*, int*) override;
 
@@ -24,7 +24,7 @@ class grib_accessor_class_getenv_t : public grib_accessor_class_ascii_t
 {
 public:
     grib_accessor_class_getenv_t(const char* name) : grib_accessor_class_ascii_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_getenv_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_getenv_t{}; }
     int pack_string(grib_accessor*, const char*, size_t* len) override;
     int unpack_string(grib_accessor*, char*, size_t* len) override;
     size_t string_length(grib_accessor*) override;
@@ -32,7 +32,7 @@ class grib_accessor_class_julian_date_t : public grib_accessor_class_double_t
 {
 public:
     grib_accessor_class_julian_date_t(const char* name) : grib_accessor_class_double_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_julian_date_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_julian_date_t{}; }
     int pack_double(grib_accessor*, const double* val, size_t* len) override;
     int pack_long(grib_accessor*, const long* val, size_t* len) override;
     int pack_string(grib_accessor*, const char*, size_t* len) override;
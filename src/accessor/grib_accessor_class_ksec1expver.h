@@ -23,7 +23,7 @@ class grib_accessor_class_ksec1expver_t : public grib_accessor_class_ascii_t
 {
 public:
     grib_accessor_class_ksec1expver_t(const char* name) : grib_accessor_class_ascii_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_ksec1expver_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_ksec1expver_t{}; }
     int pack_long(grib_accessor*, const long* val, size_t* len) override;
     int pack_string(grib_accessor*, const char*, size_t* len) override;
     int unpack_long(grib_accessor*, long* val, size_t* len) override;
@@ -32,7 +32,7 @@ class grib_accessor_class_latlon_increment_t : public grib_accessor_class_double
 {
 public:
     grib_accessor_class_latlon_increment_t(const char* name) : grib_accessor_class_double_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_latlon_increment_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_latlon_increment_t{}; }
     int is_missing(grib_accessor*) override;
     int pack_double(grib_accessor*, const double* val, size_t* len) override;
     int unpack_double(grib_accessor*, double* val, size_t* len) override;
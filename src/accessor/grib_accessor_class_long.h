@@ -19,7 +19,7 @@ class grib_accessor_class_long_t : public grib_accessor_class_gen_t
 {
 public:
     grib_accessor_class_long_t(const char* name) : grib_accessor_class_gen_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_long_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_long_t{}; }
     void init(grib_accessor* a, const long len, grib_arguments* arg) override;
     int get_native_type(grib_accessor* a) override;
     int pack_missing(grib_accessor* a) override;
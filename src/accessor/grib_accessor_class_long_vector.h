@@ -25,7 +25,7 @@ class grib_accessor_class_long_vector_t : public grib_accessor_class_abstract_lo
 {
 public:
     grib_accessor_class_long_vector_t(const char* name) : grib_accessor_class_abstract_long_vector_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_long_vector_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_long_vector_t{}; }
     int get_native_type(grib_accessor*) override;
     int pack_long(grib_accessor*, const long* val, size_t* len) override;
     int unpack_double(grib_accessor*, double* val, size_t* len) override;
@@ -105,6 +105,13 @@ int grib_accessor_class_lookup_t::unpack_long(grib_accessor* a, long* val, size_
         return h->loader->lookup_long(h->context, h->loader, a->name, val);
     }
 
+    /* Headers-only messages end before the data: there is nothing to look up past the end */
+    if (h->partial && pos / 8 + self->llength > (long)h->buffer->ulength) {
+        val[0] = 0;
+        len[0] = 1;
+        return GRIB_SUCCESS;
+    }
+
     val[0] = grib_decode_unsigned_long(h->buffer->data, &pos, self->llength * 8);
     len[0] = 1;
 
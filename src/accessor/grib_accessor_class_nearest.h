@@ -23,7 +23,7 @@ class grib_accessor_class_nearest_t : public grib_accessor_class_gen_t
 {
 public:
     grib_accessor_class_nearest_t(const char* name) : grib_accessor_class_gen_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_nearest_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_nearest_t{}; }
     void init(grib_accessor* a, const long l, grib_arguments* args) override;
     void dump(grib_accessor* a, grib_dumper* dumper) override;
 };
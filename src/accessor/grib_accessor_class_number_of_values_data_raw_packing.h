@@ -25,7 +25,7 @@ class grib_accessor_class_number_of_values_data_raw_packing_t : public grib_acce
 {
 public:
     grib_accessor_class_number_of_values_data_raw_packing_t(const char* name) : grib_accessor_class_gen_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_number_of_values_data_raw_packing_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_number_of_values_data_raw_packing_t{}; }
     int get_native_type(grib_accessor*) override;
     int unpack_long(grib_accessor*, long* val, size_t* len) override;
     void init(grib_accessor*, const long, grib_arguments*) override;
@@ -28,7 +28,7 @@ class grib_accessor_class_optimal_step_units_t : public grib_accessor_class_gen_
 {
 public:
     grib_accessor_class_optimal_step_units_t(const char* name) : grib_accessor_class_gen_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_optimal_step_units_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_optimal_step_units_t{}; }
     int get_native_type(grib_accessor*) override;
     int is_missing(grib_accessor*) override;
     int pack_long(grib_accessor*, const long* val, size_t* len) override;
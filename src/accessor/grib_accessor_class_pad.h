@@ -25,7 +25,7 @@ class grib_accessor_class_pad_t : public grib_accessor_class_padding_t
 {
 public:
     grib_accessor_class_pad_t(const char* name) : grib_accessor_class_padding_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_pad_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_pad_t{}; }
     void init(grib_accessor*, const long, grib_arguments*) override;
     size_t preferred_size(grib_accessor*, int) override;
 };
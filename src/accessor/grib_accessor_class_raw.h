@@ -26,7 +26,7 @@ class grib_accessor_class_raw_t : public grib_accessor_class_gen_t
 {
 public:
     grib_accessor_class_raw_t(const char* name) : grib_accessor_class_gen_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_raw_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_raw_t{}; }
     int get_native_type(grib_accessor*) override;
     int pack_bytes(grib_accessor*, const unsigned char*, size_t* len) override;
     int unpack_bytes(grib_accessor*, unsigned char*, size_t* len) override;
@@ -27,7 +27,7 @@ class grib_accessor_class_second_order_bits_per_value_t : public grib_accessor_c
 {
 public:
     grib_accessor_class_second_order_bits_per_value_t(const char* name) : grib_accessor_class_long_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_second_order_bits_per_value_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_second_order_bits_per_value_t{}; }
     int pack_long(grib_accessor*, const long* val, size_t* len) override;
     int unpack_long(grib_accessor*, long* val, size_t* len) override;
     void init(grib_accessor*, const long, grib_arguments*) override;
@@ -24,7 +24,7 @@ class grib_accessor_class_section_padding_t : public grib_accessor_class_padding
 {
 public:
     grib_accessor_class_section_padding_t(const char* name) : grib_accessor_class_padding_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_section_padding_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_section_padding_t{}; }
     void init(grib_accessor*, const long, grib_arguments*) override;
     size_t preferred_size(grib_accessor*, int) override;
 };
@@ -26,7 +26,7 @@ class grib_accessor_class_section_pointer_t : public grib_accessor_class_gen_t
 {
 public:
     grib_accessor_class_section_pointer_t(const char* name) : grib_accessor_class_gen_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_section_pointer_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_section_pointer_t{}; }
     int get_native_type(grib_accessor*) override;
     int unpack_string(grib_accessor*, char*, size_t* len) override;
     long byte_count(grib_accessor*) override;
@@ -23,7 +23,7 @@ class grib_accessor_class_sexagesimal2decimal_t : public grib_accessor_class_to_
 {
 public:
     grib_accessor_class_sexagesimal2decimal_t(const char* name) : grib_accessor_class_to_double_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_sexagesimal2decimal_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_sexagesimal2decimal_t{}; }
     int get_native_type(grib_accessor*) override;
     int unpack_string(grib_accessor*, char*, size_t* len) override;
     void dump(grib_accessor*, grib_dumper*) override;
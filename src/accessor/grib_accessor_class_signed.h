@@ -25,7 +25,7 @@ class grib_accessor_class_signed_t : public grib_accessor_class_long_t
 {
 public:
     grib_accessor_class_signed_t(const char* name) : grib_accessor_class_long_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_signed_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_signed_t{}; }
     int is_missing(grib_accessor*) override;
     int pack_long(grib_accessor*, const long* val, size_t* len) override;
     int unpack_long(grib_accessor*, long* val, size_t* len) override;
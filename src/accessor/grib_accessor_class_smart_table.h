@@ -33,7 +33,7 @@ class grib_accessor_class_smart_table_t : public grib_accessor_class_unsigned_t
 {
 public:
     grib_accessor_class_smart_table_t(const char* name) : grib_accessor_class_unsigned_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_smart_table_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_smart_table_t{}; }
     int get_native_type(grib_accessor*) override;
     int unpack_long(grib_accessor*, long* val, size_t* len) override;
     int unpack_string(grib_accessor*, char*, size_t* len) override;
@@ -27,7 +27,7 @@ class grib_accessor_class_spectral_truncation_t : public grib_accessor_class_lon
 {
 public:
     grib_accessor_class_spectral_truncation_t(const char* name) : grib_accessor_class_long_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_spectral_truncation_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_spectral_truncation_t{}; }
     int unpack_long(grib_accessor*, long* val, size_t* len) override;
     void init(grib_accessor*, const long, grib_arguments*) override;
 };
@@ -10,6 +10,7 @@
  */
 
 #include "grib_accessor_class_statistics.h"
+#include <float.h>
 
 grib_accessor_class_statistics_t _grib_accessor_class_statistics{"statistics"};
 grib_accessor_class* grib_accessor_class_statistics = &_grib_accessor_class_statistics;
@@ -34,24 +35,171 @@ void grib_accessor_class_statistics_t::init(grib_accessor* a, const long l, grib
     a->dirty  = 1;
 }
 
+/* Moments of a set of values: count, sum, mean and sums of powers of the deviations */
+typedef struct statistics_moments
+{
+    double n, sum, mean, m2, m3, m4, min, max;
+} statistics_moments;
+
+/* Values are reduced in blocks small enough to stay in L1 cache: the block is read
+ * once from memory, then its deviations are summed while still in cache */
+#define STATISTICS_BLOCK 1024
+#define STATISTICS_LANES 4
+
+/* Running sum, minimum and maximum of one lane */
+static inline void statistics_add(double x, double* s, double* mx, double* mn)
+{
+    *s += x;
+    *mx = x > *mx ? x : *mx;
+    *mn = x < *mn ? x : *mn;
+}
+
+/* Same, leaving out the missing values */
+static inline void statistics_add_masked(double x, double missing, double* s, double* c, double* mx, double* mn)
+{
+    const int ok    = x != missing;
+    const double hi = ok ? x : -DBL_MAX;
+    const double lo = ok ? x : DBL_MAX;
+    *s += ok ? x : 0;
+    *c += ok ? 1 : 0;
+    *mx = hi > *mx ? hi : *mx;
+    *mn = lo < *mn ? lo : *mn;
+}
+
+/* Sums of the powers 2, 3 and 4 of the deviation d of one lane */
+static inline void statistics_add_moments(double d, double* s2, double* s3, double* s4)
+{
+    const double t = d * d;
+    *s2 += t;
+    *s3 += t * d;
+    *s4 += t * t;
+}
+
+/* Moments of one block. When mask is set the values equal to missing are left out.
+ * The loops keep STATISTICS_LANES independent accumulators, and mask is tested once
+ * per block so that fields without missing values run without selects */
+static void statistics_block(const double* values, size_t n, int mask, double missing, statistics_moments* b)
+{
+    double mx[STATISTICS_LANES], mn[STATISTICS_LANES], s[STATISTICS_LANES], c[STATISTICS_LANES];
+    double s2[STATISTICS_LANES], s3[STATISTICS_LANES], s4[STATISTICS_LANES];
+    double mean = 0, count = 0;
+    size_t i = 0, k = 0, nlanes = n - n % STATISTICS_LANES;
+
+    for (k = 0; k < STATISTICS_LANES; k++) {
+        mx[k] = -DBL_MAX;
+        mn[k] = DBL_MAX;
+        s[k] = c[k] = s2[k] = s3[k] = s4[k] = 0;
+    }
+    if (mask) {
+        for (i = 0; i < nlanes; i += STATISTICS_LANES)
+            for (k = 0; k < STATISTICS_LANES; k++)
+                statistics_add_masked(values[i + k], missing, &s[k], &c[k], &mx[k], &mn[k]);
+        for (; i < n; i++)
+            statistics_add_masked(values[i], missing, &s[0], &c[0], &mx[0], &mn[0]);
+    }
+    else {
+        for (i = 0; i < nlanes; i += STATISTICS_LANES)
+            for (k = 0; k < STATISTICS_LANES; k++)
+                statistics_add(values[i + k], &s[k], &mx[k], &mn[k]);
+        for (; i < n; i++)
+            statistics_add(values[i], &s[0], &mx[0], &mn[0]);
+        c[0] = n;
+    }
+
+    b->min = mn[0];
+    b->max = mx[0];
+    for (k = 1; k < STATISTICS_LANES; k++) {
+        if (mn[k] < b->min) b->min = mn[k];
+        if (mx[k] > b->max) b->max = mx[k];
+    }
+    count  = c[0] + c[1] + c[2] + c[3];
+    b->n   = count;
+    b->sum = s[0] + s[1] + s[2] + s[3];
+    if (count == 0) {
+        b->mean = b->m2 = b->m3 = b->m4 = 0;
+        return;
+    }
+    /* A constant block has no deviations: keep its mean exact */
+    mean = (b->min == b->max) ? b->min : b->sum / count;
+
+    /* Second sweep over the block while it is still in cache */
+    if (mask) {
+        for (i = 0; i < nlanes; i += STATISTICS_LANES)
+            for (k = 0; k < STATISTICS_LANES; k++) {
+                const double x = values[i + k];
+                statistics_add_moments(x != missing ? x - mean : 0, &s2[k], &s3[k], &s4[k]);
+            }
+        for (; i < n; i++)
+            statistics_add_moments(values[i] != missing ? values[i] - mean : 0, &s2[0], &s3[0], &s4[0]);
+    }
+    else {
+        for (i = 0; i < nlanes; i += STATISTICS_LANES)
+            for (k = 0; k < STATISTICS_LANES; k++)
+                statistics_add_moments(values[i + k] - mean, &s2[k], &s3[k], &s4[k]);
+        for (; i < n; i++)
+            statistics_add_moments(values[i] - mean, &s2[0], &s3[0], &s4[0]);
+    }
+
+    b->mean = mean;
+    b->m2   = s2[0] + s2[1] + s2[2] + s2[3];
+    b->m3   = s3[0] + s3[1] + s3[2] + s3[3];
+    b->m4   = s4[0] + s4[1] + s4[2] + s4[3];
+}
+
+/* Merge the moments of b into a (pairwise update of Chan et al. and Pebay) */
+static void statistics_merge(statistics_moments* a, const statistics_moments* b)
+{
+    double na = a->n, nb = b->n, n = 0, delta = 0, d_n = 0, d2 = 0, m2, m3, m4;
+
+    if (nb == 0)
+        return;
+    if (na == 0) {
+        *a = *b;
+        return;
+    }
+    n     = na + nb;
+    delta = b->mean - a->mean;
+    d_n   = delta / n;
+    d2    = delta * d_n * na * nb; /* delta^2 * na * nb / n */
+
+    m2 = a->m2 + b->m2 + d2;
+    m3 = a->m3 + b->m3 + d2 * d_n * (na - nb) + 3.0 * d_n * (na * b->m2 - nb * a->m2);
+    m4 = a->m4 + b->m4 + d2 * d_n * d_n * (na * na - na * nb + nb * nb) +
+         6.0 * d_n * d_n * (na * na * b->m2 + nb * nb * a->m2) + 4.0 * d_n * (na * b->m3 - nb * a->m3);
+
+    a->mean = (delta == 0) ? a->mean : a->mean + d_n * nb;
+    a->m2   = m2;
+    a->m3   = m3;
+    a->m4   = m4;
+    a->sum += b->sum;
+    a->n    = n;
+    if (b->min < a->min) a->min = b->min;
+    if (b->max > a->max) a->max = b->max;
+}
+
 int grib_accessor_class_statistics_t::unpack_double(grib_accessor* a, double* val, size_t* len){
     grib_accessor_statistics_t* self = (grib_accessor_statistics_t*)a;
     int ret = 0;
     double* values = NULL;
-    size_t i = 0, size = 0, real_size = 0;
-    double max, min, avg, sd, value, skew, kurt, m2 = 0, m3 = 0, m4 = 0;
+    size_t i = 0, size = 0;
+    double max, min, avg, sd, skew, kurt, m2 = 0, m3 = 0, m4 = 0;
     double missing            = 0;
     long missingValuesPresent = 0;
     size_t number_of_missing  = 0;
+    statistics_moments total  = {0,};
     grib_context* c           = a->context;
     grib_handle* h            = grib_handle_of_accessor(a);
 
-    if (!a->dirty)
-        return GRIB_SUCCESS;
-
     if (*len != self->number_of_elements)
         return GRIB_ARRAY_TOO_SMALL;
 
+    if (!a->dirty) {
+        /* Cached until the values change */
+        for (i = 0; i < self->number_of_elements; i++)
+            val[i] = self->v[i];
+        return GRIB_SUCCESS;
+    }
+
     if ((ret = grib_get_size(h, self->values, &size)) != GRIB_SUCCESS)
         return ret;
 
@@ -63,7 +211,7 @@ int grib_accessor_class_statistics_t::unpack_double(grib_accessor* a, double* va
     if ((ret = grib_get_long_internal(h, "missingValuesPresent", &missingValuesPresent)) != GRIB_SUCCESS)
         return ret;
 
-    values = (double*)grib_context_malloc_clear(c, size * sizeof(double));
+    values = (double*)grib_context_malloc(c, (size ? size : 1) * sizeof(double));
     if (!values)
         return GRIB_OUT_OF_MEMORY;
 
@@ -72,76 +220,32 @@ int grib_accessor_class_statistics_t::unpack_double(grib_accessor* a, double* va
         return ret;
     }
 
-    number_of_missing = 0;
-    if (missingValuesPresent) {
-        i = 0;
-        while (i < size && values[i] == missing) {
-            i++;
-            number_of_missing++;
-        }
-        if (number_of_missing == size) {
-            /* ECC-649: All values are missing */
-            min = max = avg = missing;
-        }
-        else {
-            max = values[i];
-            min = values[i];
-            avg = values[i];
-            for (i = number_of_missing + 1; i < size; i++) {
-                value = values[i];
-                if (value > max && value != missing)
-                    max = value;
-                if (value < min && value != missing)
-                    min = value;
-                if (value != missing)
-                    avg += value;
-                else
-                    number_of_missing++;
-            }
-        }
-    }
-    else {
-        max = values[0];
-        min = values[0];
-        avg = values[0];
-        for (i = 1; i < size; i++) {
-            value = values[i];
-            if (value > max)
-                max = value;
-            if (value < min)
-                min = value;
-            avg += value;
-        }
-    }
-    /*printf("stats.......... number_of_missing=%ld\n", number_of_missing);*/
-    /* Don't divide by zero if all values are missing! */
-    if (size != number_of_missing) {
-        avg /= (size - number_of_missing);
+    /* Single pass over the values, one cache-sized block at a time */
+    for (i = 0; i < size; i += STATISTICS_BLOCK) {
+        statistics_moments block;
+        const size_t n = size - i < STATISTICS_BLOCK ? size - i : STATISTICS_BLOCK;
+        statistics_block(values + i, n, missingValuesPresent != 0, missing, &block);
+        statistics_merge(&total, &block);
     }
+    grib_context_free(c, values);
 
+    number_of_missing = size - (size_t)total.n;
     sd   = 0;
     skew = 0;
     kurt = 0;
-    for (i = 0; i < size; i++) {
-        int valueNotMissing = 1;
-        if (missingValuesPresent) {
-            valueNotMissing = (values[i] != missing);
-        }
-        if (valueNotMissing) {
-            double v   = values[i] - avg;
-            double tmp = v * v;
-            m2 += tmp;
-            m3 += v * tmp;
-            m4 += tmp * tmp;
-        }
+    if (total.n == 0) {
+        /* ECC-649: All values are missing */
+        min = max = avg = missing;
     }
-
-    real_size = size - number_of_missing;
-    if (real_size != 0) {
-        m2 /= real_size;
-        m3 /= real_size;
-        m4 /= real_size;
-        sd = sqrt(m2);
+    else {
+        max = total.max;
+        min = total.min;
+        /* The sum of the block sums rounds less than the merged mean */
+        avg = (min == max) ? min : total.sum / total.n;
+        m2  = total.m2 / total.n;
+        m3  = total.m3 / total.n;
+        m4  = total.m4 / total.n;
+        sd  = sqrt(m2);
     }
     if (m2 != 0) {
         skew = m3 / (sd * sd * sd);
@@ -149,8 +253,6 @@ int grib_accessor_class_statistics_t::unpack_double(grib_accessor* a, double* va
     }
     a->dirty = 0;
 
-    grib_context_free(c, values);
-
     self->v[0] = max;
     self->v[1] = min;
     self->v[2] = avg;
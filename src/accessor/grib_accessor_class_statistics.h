@@ -25,7 +25,7 @@ class grib_accessor_class_statistics_t : public grib_accessor_class_abstract_vec
 {
 public:
     grib_accessor_class_statistics_t(const char* name) : grib_accessor_class_abstract_vector_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_statistics_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_statistics_t{}; }
     int unpack_double(grib_accessor*, double* val, size_t* len) override;
     int unpack_string(grib_accessor*, char*, size_t* len) override;
     int value_count(grib_accessor*, long*) override;
@@ -20,6 +20,6 @@ class grib_accessor_class_transient_t : public grib_accessor_class_variable_t {
 public:
     void init(grib_accessor* a, const long l, grib_arguments* args) override;
     grib_accessor_class_transient_t(const char* name) : grib_accessor_class_variable_t(name) {};
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_transient_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_transient_t{}; }
 };
 
@@ -23,7 +23,7 @@ class grib_accessor_class_uint64_little_endian_t : public grib_accessor_class_ge
 {
 public:
     grib_accessor_class_uint64_little_endian_t(const char* name) : grib_accessor_class_gen_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_uint64_little_endian_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_uint64_little_endian_t{}; }
     int get_native_type(grib_accessor*) override;
     int unpack_long(grib_accessor*, long* val, size_t* len) override;
 };
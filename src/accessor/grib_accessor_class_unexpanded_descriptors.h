@@ -25,7 +25,7 @@ class grib_accessor_class_unexpanded_descriptors_t : public grib_accessor_class_
 {
 public:
     grib_accessor_class_unexpanded_descriptors_t(const char* name) : grib_accessor_class_long_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_unexpanded_descriptors_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_unexpanded_descriptors_t{}; }
     int pack_long(grib_accessor*, const long* val, size_t* len) override;
     int unpack_long(grib_accessor*, long* val, size_t* len) override;
     long byte_offset(grib_accessor*) override;
@@ -24,7 +24,7 @@ class grib_accessor_class_unsigned_t : public grib_accessor_class_long_t
 {
 public:
     grib_accessor_class_unsigned_t(const char* name) : grib_accessor_class_long_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_unsigned_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_unsigned_t{}; }
     void init(grib_accessor* a, const long len, grib_arguments* arg) override;
     void dump(grib_accessor* a, grib_dumper* dumper) override;
     int unpack_long(grib_accessor* a, long* val, size_t* len) override;
@@ -215,7 +215,7 @@ void grib_accessor_class_variable_t::destroy(grib_context* c, grib_accessor* a)
     /* Note: BUFR operator descriptors are variables and have attributes so need to free them */
     while (i < MAX_ACCESSOR_ATTRIBUTES && a->attributes[i]) {
         a->attributes[i]->destroy(c);
-        a->attributes[i] = NULL;
+        a->attributes.set(c, i, NULL);
         ++i;
     }
 
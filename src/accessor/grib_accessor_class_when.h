@@ -23,7 +23,7 @@ class grib_accessor_class_when_t : public grib_accessor_class_gen_t
 {
 public:
     grib_accessor_class_when_t(const char* name) : grib_accessor_class_gen_t(name) {}
-    grib_accessor* create_empty_accessor() override { return new grib_accessor_when_t{}; }
+    grib_accessor* create_empty_accessor(grib_handle* h) override { return new (h) grib_accessor_when_t{}; }
     int get_native_type(grib_accessor*) override;
     void dump(grib_accessor*, grib_dumper*) override;
     void init(grib_accessor*, const long, grib_arguments*) override;
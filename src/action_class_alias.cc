@@ -147,8 +147,7 @@ static int create_accessor(grib_section* p, grib_action* act, grib_loader* h)
         while (i < MAX_ACCESSOR_NAMES) {
             if (x->all_names[i] != NULL && !grib_inline_strcmp(x->all_names[i], act->name)) {
                 if (x->all_name_spaces[i] == NULL) {
-                    x->all_name_spaces[i] = act->name_space;
-                    return GRIB_SUCCESS;
+                    return x->all_name_spaces.set(x->context, i, act->name_space);
                 }
                 else if (!grib_inline_strcmp(x->all_name_spaces[i], act->name_space)) {
                     return GRIB_SUCCESS;
@@ -159,9 +158,8 @@ static int create_accessor(grib_section* p, grib_action* act, grib_loader* h)
         i = 0;
         while (i < MAX_ACCESSOR_NAMES) {
             if (x->all_names[i] == NULL) {
-                x->all_names[i]       = act->name;
-                x->all_name_spaces[i] = act->name_space;
-                return GRIB_SUCCESS;
+                x->all_names.set(x->context, i, act->name);
+                return x->all_name_spaces.set(x->context, i, act->name_space);
             }
             i++;
         }
@@ -183,13 +181,13 @@ static int create_accessor(grib_section* p, grib_action* act, grib_loader* h)
                 /* printf("[%s %s]\n",y->all_names[i], y->all_name_spaces[i]); */
 
                 while (i < MAX_ACCESSOR_NAMES - 1) {
-                    y->all_names[i]       = y->all_names[i + 1];
-                    y->all_name_spaces[i] = y->all_name_spaces[i + 1];
+                    y->all_names.set(y->context, i, y->all_names[i + 1]);
+                    y->all_name_spaces.set(y->context, i, y->all_name_spaces[i + 1]);
                     i++;
                 }
 
-                y->all_names[MAX_ACCESSOR_NAMES - 1]       = NULL;
-                y->all_name_spaces[MAX_ACCESSOR_NAMES - 1] = NULL;
+                y->all_names.set(y->context, MAX_ACCESSOR_NAMES - 1, NULL);
+                y->all_name_spaces.set(y->context, MAX_ACCESSOR_NAMES - 1, NULL);
 
                 break;
             }
@@ -215,7 +213,7 @@ static int create_accessor(grib_section* p, grib_action* act, grib_loader* h)
     hand = grib_handle_of_accessor(x);
     if (hand->use_trie) {
         id = grib_hash_keys_get_id(x->context->keys, act->name);
-        hand->accessors[id] = x;
+        grib_handle_cache_accessor(hand, id, x);
 
         /*
          if (hand->accessors[id] != x) {
@@ -238,8 +236,8 @@ static int create_accessor(grib_section* p, grib_action* act, grib_loader* h)
                 }
             }
             if (!found) { /* Not there. So add them */
-                x->all_names[i]       = act->name;
-                x->all_name_spaces[i] = act->name_space;
+                x->all_names.set(x->context, i, act->name);
+                x->all_name_spaces.set(x->context, i, act->name_space);
                 grib_context_log(p->h->context, GRIB_LOG_DEBUG, "alias %s.%s added (%s)",
                                  act->name_space, act->name, self->target);
             }
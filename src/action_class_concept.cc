@@ -219,43 +219,15 @@ static void destroy(grib_context* context, grib_action* act)
     grib_context_free_persistent(context, self->basename);
 }
 
-static grib_concept_value* get_concept_impl(grib_handle* h, grib_action_concept* self)
+static grib_concept_value* load_concept(grib_handle* h, grib_action_concept* self, int id,
+                                        const char* master, const char* local)
 {
-    char buf[4096] = {0,};
-    char master[1024] = {0,};
-    char local[1024] = {0,};
-    char masterDir[1024] = {0,};
-    size_t lenMasterDir = 1024;
-    char key[4096]      = {0,};
-    char* full = 0;
-    int id;
-    const size_t bufLen = sizeof(buf);
-    const size_t keyLen = sizeof(key);
-
     grib_context* context = ((grib_action*)self)->context;
     grib_concept_value* c = NULL;
+    grib_concept_value* v = NULL;
+    char* full            = 0;
 
-    if (self->concept_value != NULL)
-        return self->concept_value;
-
-    Assert(self->masterDir);
-    grib_get_string(h, self->masterDir, masterDir, &lenMasterDir);
-
-    snprintf(buf, bufLen, "%s/%s", masterDir, self->basename);
-
-    grib_recompose_name(h, NULL, buf, master, 1);
-
-    if (self->localDir) {
-        char localDir[1024] = {0,};
-        size_t lenLocalDir = 1024;
-        grib_get_string(h, self->localDir, localDir, &lenLocalDir);
-        snprintf(buf, bufLen, "%s/%s", localDir, self->basename);
-        grib_recompose_name(h, NULL, buf, local, 1);
-    }
-
-    snprintf(key, keyLen, "%s%s", master, local);
-
-    id = grib_itrie_get_id(h->context->concepts_index, key);
+    /* Another thread may have loaded it meanwhile */
     if ((c = h->context->concepts[id]) != NULL)
         return c;
 
@@ -290,29 +262,62 @@ static grib_concept_value* get_concept_impl(grib_handle* h, grib_action_concept*
                          "Loading concept %s from %s", ((grib_action*)self)->name, full);
     }
 
-    h->context->concepts[id] = c;
     if (c) {
         grib_trie* index = grib_trie_new(context);
-        while (c) {
-            c->index = index;
-            grib_trie_insert_no_replace(index, c->name, c);
-            c = c->next;
+        for (v = c; v; v = v->next) {
+            v->index = index;
+            grib_trie_insert_no_replace(index, v->name, v);
         }
     }
 
-    return h->context->concepts[id];
+    h->context->concepts[id].store(c, std::memory_order_release);
+    return c;
 }
 
 static grib_concept_value* get_concept(grib_handle* h, grib_action_concept* self)
 {
-    grib_concept_value* result = NULL;
-    GRIB_MUTEX_INIT_ONCE(&once, &init);
-    GRIB_MUTEX_LOCK(&mutex);
+    char buf[4096] = {0,};
+    char master[1024] = {0,};
+    char local[1024] = {0,};
+    char masterDir[1024] = {0,};
+    size_t lenMasterDir = 1024;
+    char key[4096]      = {0,};
+    int id;
+    const size_t bufLen = sizeof(buf);
+    const size_t keyLen = sizeof(key);
+
+    grib_concept_value* c = NULL;
+
+    if (self->concept_value != NULL)
+        return self->concept_value;
+
+    Assert(self->masterDir);
+    grib_get_string(h, self->masterDir, masterDir, &lenMasterDir);
+
+    snprintf(buf, bufLen, "%s/%s", masterDir, self->basename);
 
-    result = get_concept_impl(h, self);
+    grib_recompose_name(h, NULL, buf, master, 1);
 
+    if (self->localDir) {
+        char localDir[1024] = {0,};
+        size_t lenLocalDir = 1024;
+        grib_get_string(h, self->localDir, localDir, &lenLocalDir);
+        snprintf(buf, bufLen, "%s/%s", localDir, self->basename);
+        grib_recompose_name(h, NULL, buf, local, 1);
+    }
+
+    snprintf(key, keyLen, "%s%s", master, local);
+
+    id = grib_itrie_get_id(h->context->concepts_index, key);
+    /* Concepts are only published once indexed, so the cache is read without the lock */
+    if ((c = h->context->concepts[id].load(std::memory_order_acquire)) != NULL)
+        return c;
+
+    GRIB_MUTEX_INIT_ONCE(&once, &init);
+    GRIB_MUTEX_LOCK(&mutex);
+    c = load_concept(h, self, id, master, local);
     GRIB_MUTEX_UNLOCK(&mutex);
-    return result;
+    return c;
 }
 
 static int concept_condition_expression_true(grib_handle* h, grib_concept_condition* c, char* exprVal)
@@ -114,6 +114,33 @@ static int execute(grib_action* act, grib_handle* h)
     int err                 = 0;
     FILE* out               = NULL;
     int ioerr               = 0;
+    grib_output_capture* oc = grib_output_capture_current();
+
+    if (oc) {
+        /* Print to a scratch file and hold the text back for the capturing tool */
+        char* text  = NULL;
+        long length = 0;
+        out         = tmpfile();
+        if (!out) {
+            grib_context_log(act->context, (GRIB_LOG_ERROR) | (GRIB_LOG_PERROR), "Unable to create temporary file");
+            return GRIB_IO_PROBLEM;
+        }
+        err = grib_recompose_print(h, NULL, self->name, 0, out);
+        length = ftell(out);
+        rewind(out);
+        text = (char*)malloc(length > 0 ? length : 1);
+        if (!text) {
+            fclose(out);
+            return GRIB_OUT_OF_MEMORY;
+        }
+        if (fread(text, 1, length, out) != (size_t)length)
+            err = GRIB_IO_PROBLEM;
+        else
+            grib_output_capture_add(oc, self->outname, "a", 0, text, length);
+        free(text);
+        fclose(out);
+        return err;
+    }
 
     if (self->outname) {
         out   = fopen(self->outname, "a");
@@ -100,7 +100,7 @@ static void remove_accessor(grib_accessor* a)
 
     if (grib_handle_of_accessor(a)->use_trie && *(a->all_names[0]) != '_') {
         id = grib_hash_keys_get_id(a->context->keys, a->all_names[0]);
-        grib_handle_of_accessor(a)->accessors[id] = NULL;
+        grib_handle_cache_accessor(grib_handle_of_accessor(a), id, NULL);
     }
 
     if (a->next_)
@@ -98,13 +98,13 @@ static void rename_accessor(grib_accessor* a, char* name)
     char* the_old = (char*)a->all_names[0];
 
     if (grib_handle_of_accessor(a)->use_trie && *(a->all_names[0]) != '_') {
-        id                                        = grib_hash_keys_get_id(a->context->keys, a->all_names[0]);
-        grib_handle_of_accessor(a)->accessors[id] = NULL;
-        id                                        = grib_hash_keys_get_id(a->context->keys, name);
-        grib_handle_of_accessor(a)->accessors[id] = a;
+        id = grib_hash_keys_get_id(a->context->keys, a->all_names[0]);
+        grib_handle_cache_accessor(grib_handle_of_accessor(a), id, NULL);
+        id = grib_hash_keys_get_id(a->context->keys, name);
+        grib_handle_cache_accessor(grib_handle_of_accessor(a), id, a);
     }
-    a->all_names[0] = grib_context_strdup_persistent(a->context, name);
-    a->name         = a->all_names[0];
+    a->all_names.set(a->context, 0, grib_context_strdup_persistent(a->context, name));
+    a->name = a->all_names[0];
     grib_context_log(a->context, GRIB_LOG_DEBUG, "Renaming %s to %s", the_old, name);
     /* grib_context_free(a->context,the_old); */
 }
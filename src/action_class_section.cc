@@ -81,8 +81,124 @@ static void init_class(grib_action_class* c)
 //     }
 // }
 
+/* Is accessor 'a' the section accessor 'outer' or inside its sub-section? */
+static int accessor_is_within(grib_accessor* a, const grib_accessor* outer)
+{
+    while (a) {
+        if (a == outer)
+            return 1;
+        a = a->parent ? a->parent->owner : NULL;
+    }
+    return 0;
+}
+
+static int accessor_depth(const grib_accessor* a)
+{
+    int depth = 0;
+    while (a) {
+        depth++;
+        a = a->parent ? a->parent->owner : NULL;
+    }
+    return depth;
+}
+
+/* Forget deferred reparses of sections which are about to be rebuilt as part of 'notified' */
+static void drop_deferred_within(grib_handle* h, const grib_accessor* notified)
+{
+    size_t i = 0, j = 0;
+    for (i = 0; i < h->deferred_count; i++) {
+        if (!accessor_is_within(h->deferred[i].notified, notified))
+            h->deferred[j++] = h->deferred[i];
+    }
+    h->deferred_count = j;
+}
+
+static int defer_reparse(grib_handle* h, grib_action* act, grib_accessor* notified, int changing_edition)
+{
+    size_t i = 0;
+
+    for (i = 0; i < h->deferred_count; i++) {
+        if (h->deferred[i].notified == notified) {
+            h->deferred[i].changing_edition |= changing_edition;
+            return GRIB_SUCCESS;
+        }
+    }
+
+    if (h->deferred_count == h->deferred_size) {
+        size_t size                  = h->deferred_size ? 2 * h->deferred_size : 8;
+        grib_deferred_reparse* items = (grib_deferred_reparse*)grib_context_realloc(h->context, h->deferred,
+                                                                                   size * sizeof(grib_deferred_reparse));
+        if (!items)
+            return GRIB_OUT_OF_MEMORY;
+        h->deferred      = items;
+        h->deferred_size = size;
+    }
+    h->deferred[h->deferred_count].act              = act;
+    h->deferred[h->deferred_count].notified         = notified;
+    h->deferred[h->deferred_count].changing_edition = changing_edition;
+    h->deferred_count++;
+
+    grib_context_log(h->context, GRIB_LOG_DEBUG, "------------- DEFER action %s (%s)", act->name, notified->name);
+    return GRIB_SUCCESS;
+}
+
+static int reparse_section(grib_action* act, grib_accessor* notified, int changing_edition);
+
 static int notify_change(grib_action* act, grib_accessor* notified,
                          grib_accessor* changed)
+{
+    grib_handle* h       = grib_handle_of_accessor(notified);
+    int changing_edition = !strcmp(changed->name, "GRIBEditionNumber");
+
+    if (h->context->debug > 0) {
+        char debug_str[1024] = {0,};
+        if (act->debug_info) {
+            snprintf(debug_str, 1024, " (%s)", act->debug_info);
+        }
+        grib_context_log(h->context,
+                         GRIB_LOG_DEBUG, "------------- SECTION action %s (%s) is triggered by [%s]%s",
+                         act->name, notified->name, changed->name, debug_str);
+    }
+
+    /* Inside a set transaction the keys given by the caller only mark the section;
+     * it is rebuilt once, after all the selectors have been set */
+    if (h->set_deferring && changed == h->set_current)
+        return defer_reparse(h, act, notified, changing_edition);
+
+    return reparse_section(act, notified, changing_edition);
+}
+
+int grib_section_reparse_deferred(grib_handle* h)
+{
+    int err = GRIB_SUCCESS;
+
+    /* Outermost sections first: rebuilding one drops the pending sections it contains.
+     * Take them one at a time since the list changes under us */
+    while (h->deferred_count > 0) {
+        grib_deferred_reparse r;
+        size_t i = 0, first = 0;
+        int depth = accessor_depth(h->deferred[0].notified);
+        for (i = 1; i < h->deferred_count; i++) {
+            int d = accessor_depth(h->deferred[i].notified);
+            if (d < depth) {
+                depth = d;
+                first = i;
+            }
+        }
+        r = h->deferred[first];
+        h->deferred_count--;
+        memmove(h->deferred + first, h->deferred + first + 1, (h->deferred_count - first) * sizeof(grib_deferred_reparse));
+
+        err = reparse_section(r.act, r.notified, r.changing_edition);
+        if (err) {
+            h->deferred_count = 0;
+            break;
+        }
+    }
+    return err;
+}
+
+static int reparse_section(grib_action* act, grib_accessor* notified, int changing_edition)
 {
     grib_loader loader = { 0, 0, 0, 0, 0 };
 
@@ -96,16 +212,6 @@ static int notify_change(grib_action* act, grib_accessor* notified,
 
     grib_action* la = NULL;
 
-    if (h->context->debug > 0) {
-        char debug_str[1024] = {0,};
-        if (act->debug_info) {
-            snprintf(debug_str, 1024, " (%s)", act->debug_info);
-        }
-        grib_context_log(h->context,
-                         GRIB_LOG_DEBUG, "------------- SECTION action %s (%s) is triggered by [%s]%s",
-                         act->name, notified->name, changed->name, debug_str);
-    }
-
     la          = grib_action_reparse(act, notified, &doit);
     old_section = notified->sub_section;
     if (!old_section) return GRIB_INTERNAL_ERROR;
@@ -130,10 +236,11 @@ static int notify_change(grib_action* act, grib_accessor* notified,
 
     loader.list_is_resized = (la == old_section->branch);
 
-    if (!strcmp(changed->name, "GRIBEditionNumber"))
-        loader.changing_edition = 1;
-    else
-        loader.changing_edition = 0;
+    loader.changing_edition = changing_edition;
+
+    /* The sections below 'notified' are rebuilt too */
+    if (h->deferred_count)
+        drop_deferred_within(h, notified);
 
     old_section->branch = la;
 
@@ -197,6 +304,9 @@ static int notify_change(grib_action* act, grib_accessor* notified,
     grib_buffer_replace(notified, tmp_handle->buffer->data, tmp_handle->buffer->ulength, 0, 1);
 
     Assert(tmp_handle->root->block->first != NULL);
+    /* Only the keys of the replaced section need relinking in the lookup cache */
+    if (grib_handle_replace_cached_section(h, old_section, tmp_handle->root->block->first->sub_section) != GRIB_SUCCESS)
+        h->trie_invalid = 1;
     grib_swap_sections(old_section,
                        tmp_handle->root->block->first->sub_section);
 
@@ -205,9 +315,8 @@ static int notify_change(grib_action* act, grib_accessor* notified,
 
     grib_handle_delete(tmp_handle);
 
-    h->use_trie     = 1;
-    h->trie_invalid = 1;
-    h->kid          = NULL;
+    h->use_trie = 1;
+    h->kid      = NULL;
 
     err = grib_section_adjust_sizes(h->root, 1, 0);
     if (err)
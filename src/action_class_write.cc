@@ -97,16 +97,44 @@ grib_action* grib_action_create_write(grib_context* context, const char* name, i
     return act;
 }
 
+static const char gts_trailer[4] = { '\x0D', '\x0D', '\x0A', '\x03' };
+
+/* Same bytes as below, held back until the capturing tool replays them */
+static int capture_message(grib_output_capture* oc, grib_handle* h, const char* filename, const char* mode,
+                           const void* buffer, size_t size, int padtomultiple)
+{
+    int err = GRIB_SUCCESS;
+    if (h->gts_header)
+        err = grib_output_capture_add(oc, filename, mode, 1, h->gts_header, h->gts_header_len);
+    if (!err)
+        err = grib_output_capture_add(oc, filename, mode, 1, buffer, size);
+    if (!err && padtomultiple) {
+        if (padtomultiple < 0)
+            return GRIB_INVALID_ARGUMENT;
+        size_t padding = padtomultiple - size % padtomultiple;
+        char* zeros    = (char*)calloc(padding, 1);
+        if (!zeros)
+            return GRIB_OUT_OF_MEMORY;
+        err = grib_output_capture_add(oc, filename, mode, 1, zeros, padding);
+        free(zeros);
+    }
+    if (!err && h->gts_header)
+        err = grib_output_capture_add(oc, filename, mode, 1, gts_trailer, 4);
+    return err;
+}
+
 static int execute(grib_action* act, grib_handle* h)
 {
     grib_action_write* a = (grib_action_write*)act;
     int err              = GRIB_SUCCESS;
+    int ret              = GRIB_SUCCESS;
     size_t size          = 0;
     const void* buffer   = NULL;
     const char* filename = NULL;
     char string[1024]    = {0,};
 
     grib_file* of = NULL;
+    grib_output_capture* oc = NULL;
 
     if ((err = grib_get_message(h, &buffer, &size)) != GRIB_SUCCESS) {
         grib_context_log(act->context, GRIB_LOG_ERROR, "unable to get message");
@@ -130,6 +158,9 @@ static int execute(grib_action* act, grib_handle* h)
     }
 
     Assert(filename);
+    if ((oc = grib_output_capture_current()) != NULL)
+        return capture_message(oc, h, filename, a->append ? "a" : "w", buffer, size, a->padtomultiple);
+
     if (a->append)
         of = grib_file_open(filename, "a", &err);
     else
@@ -145,44 +176,55 @@ static int execute(grib_action* act, grib_handle* h)
         if (fwrite(h->gts_header, 1, h->gts_header_len, of->handle) != h->gts_header_len) {
             grib_context_log(act->context, (GRIB_LOG_ERROR) | (GRIB_LOG_PERROR),
                              "Error writing GTS header to '%s'", filename);
-            return GRIB_IO_PROBLEM;
+            ret = GRIB_IO_PROBLEM;
+            goto cleanup;
         }
     }
 
     if (fwrite(buffer, 1, size, of->handle) != size) {
         grib_context_log(act->context, (GRIB_LOG_ERROR) | (GRIB_LOG_PERROR),
                          "Error writing to '%s'", filename);
-        return GRIB_IO_PROBLEM;
+        ret = GRIB_IO_PROBLEM;
+        goto cleanup;
     }
 
     if (a->padtomultiple) {
         char* zeros = NULL;
-        if (a->padtomultiple < 0)
-            return GRIB_INVALID_ARGUMENT;
+        if (a->padtomultiple < 0) {
+            ret = GRIB_INVALID_ARGUMENT;
+            goto cleanup;
+        }
         size_t padding = a->padtomultiple - size % a->padtomultiple;
         /* printf("XXX padding=%zu size=%zu padtomultiple=%d\n", padding, size,a->padtomultiple); */
         zeros = (char*)calloc(padding, 1);
-        if (!zeros)
-            return GRIB_OUT_OF_MEMORY;
+        if (!zeros) {
+            ret = GRIB_OUT_OF_MEMORY;
+            goto cleanup;
+        }
         if (fwrite(zeros, 1, padding, of->handle) != padding) {
             grib_context_log(act->context, (GRIB_LOG_ERROR) | (GRIB_LOG_PERROR),
                              "Error writing to '%s'", filename);
             free(zeros);
-            return GRIB_IO_PROBLEM;
+            ret = GRIB_IO_PROBLEM;
+            goto cleanup;
         }
         free(zeros);
     }
 
     if (h->gts_header) {
-        const char gts_trailer[4] = { '\x0D', '\x0D', '\x0A', '\x03' };
         if (fwrite(gts_trailer, 1, 4, of->handle) != 4) {
             grib_context_log(act->context, (GRIB_LOG_ERROR) | (GRIB_LOG_PERROR),
                              "Error writing GTS trailer to '%s'", filename);
-            return GRIB_IO_PROBLEM;
+            ret = GRIB_IO_PROBLEM;
+            goto cleanup;
         }
     }
 
+cleanup:
+    /* Pairs with the open above, also on error */
     grib_file_close(filename, 0, &err);
+    if (ret != GRIB_SUCCESS)
+        return ret;
     if (err != GRIB_SUCCESS) {
         grib_context_log(act->context, GRIB_LOG_ERROR, "Unable to write message");
         return err;
@@ -9,6 +9,7 @@
  */
 
 #include "grib_api_internal.h"
+#include "accessor/grib_accessor_class_bufr_data_array.h"
 
 bufr_keys_iterator* codes_bufr_keys_iterator_new(grib_handle* h, unsigned long filter_flags)
 {
@@ -70,17 +71,77 @@ bufr_keys_iterator* codes_bufr_data_section_keys_iterator_new(grib_handle* h)
     return ki;
 }
 
-static void mark_seen(bufr_keys_iterator* ki, const char* name)
+/* Take the snapshot of the data keys as they are now. The counts of the data keys are
+ * kept in a flat array so iterating over them does not allocate */
+static int use_snapshot(bufr_keys_iterator* ki)
 {
-    int* r = (int*)grib_trie_get(ki->seen, name);
+    grib_context* c             = ki->handle->context;
+    grib_accessor* data         = grib_find_accessor(ki->handle, "dataAccessors");
+    const bufr_keys_snapshot* s = data ? accessor_bufr_data_array_get_keys_snapshot(data) : NULL;
+
+    ki->snapshot_next = 0;
+    /* A rebuilt snapshot can have the address of the previous one (e.g. after unpack
+     * is set again), so the size is checked before the pointer */
+    if (s && s->nnames > ki->seen_counts_size) {
+        grib_context_free(c, ki->seen_counts);
+        ki->snapshot         = NULL; /* New counts: start again from zero */
+        ki->seen_counts      = (int*)grib_context_malloc(c, s->nnames * sizeof(int));
+        ki->seen_counts_size = ki->seen_counts ? s->nnames : 0;
+        if (!ki->seen_counts)
+            return GRIB_OUT_OF_MEMORY;
+    }
+    if (s == ki->snapshot)
+        return GRIB_SUCCESS;
+    ki->snapshot = s;
+    if (s && s->nnames)
+        memset(ki->seen_counts, 0, s->nnames * sizeof(int));
+    return GRIB_SUCCESS;
+}
+
+/* The accessors are visited in the order of the snapshot, apart from a few (e.g. those
+ * moved into a bitmap group): if a is the next entry return the index of its name */
+static long snapshot_next_entry(bufr_keys_iterator* ki, const grib_accessor* a)
+{
+    const bufr_keys_snapshot* s = ki->snapshot;
+    if (s && ki->snapshot_next < s->n && s->entries[ki->snapshot_next].accessor == a)
+        return (long)s->entries[ki->snapshot_next++].name_index;
+    return -1;
+}
+
+/* Count the occurrences of each key name, for the rank of the data keys.
+ * idx is the index of the name in the snapshot if already known */
+static void mark_seen(bufr_keys_iterator* ki, const grib_accessor* a, long idx)
+{
+    int* r;
+
+    if (idx < 0 && ki->snapshot)
+        idx = bufr_keys_snapshot_name_index(ki->snapshot, a->name);
+    if (idx >= 0) {
+        ki->rank = ++ki->seen_counts[idx];
+        return;
+    }
 
+    r = (int*)grib_trie_get(ki->seen, a->name);
     if (r)
         (*r)++;
     else {
         r  = (int*)grib_context_malloc(ki->handle->context, sizeof(int));
         *r = 1;
-        grib_trie_insert(ki->seen, name, (void*)r);
+        grib_trie_insert(ki->seen, a->name, (void*)r);
     }
+    ki->rank = *r;
+}
+
+/* Make sure the buffer holds size bytes, keeping its content */
+static char* reserve(const grib_context* c, char* buf, size_t* capacity, size_t size)
+{
+    if (size > *capacity) {
+        char* p = (char*)grib_context_realloc(c, buf, size);
+        if (!p) return NULL;
+        *capacity = size;
+        return p;
+    }
+    return buf;
 }
 
 int codes_bufr_keys_iterator_rewind(bufr_keys_iterator* ki)
@@ -91,6 +152,8 @@ int codes_bufr_keys_iterator_rewind(bufr_keys_iterator* ki)
 
 static int skip(bufr_keys_iterator* kiter)
 {
+    const long idx = snapshot_next_entry(kiter, kiter->current);
+
     if (kiter->current->sub_section)
         return 1;
 
@@ -99,7 +162,7 @@ static int skip(bufr_keys_iterator* kiter)
     }
 
     if (kiter->accessor_flags_only == (kiter->current->flags & kiter->accessor_flags_only)) {
-        mark_seen(kiter, kiter->current->name);
+        mark_seen(kiter, kiter->current, idx);
         return 0;
     }
     else {
@@ -109,50 +172,56 @@ static int skip(bufr_keys_iterator* kiter)
 
 static int next_attribute(bufr_keys_iterator* kiter)
 {
-    int* r = 0;
+    const grib_context* c = kiter->handle->context;
     int i_curr_attribute;
     if (!kiter->current)
         return 0;
-    if (!kiter->attributes) {
-        kiter->attributes       = kiter->current->attributes;
-        kiter->prefix           = 0;
+    if (!kiter->attributes_of) {
+        kiter->attributes_of    = kiter->current;
+        kiter->has_prefix       = 0;
         kiter->i_curr_attribute = 0;
     }
     i_curr_attribute = kiter->i_curr_attribute - 1;
 
-    while (kiter->i_curr_attribute < MAX_ACCESSOR_ATTRIBUTES && kiter->attributes[kiter->i_curr_attribute]) {
-        if ((kiter->attributes[kiter->i_curr_attribute]->flags & GRIB_ACCESSOR_FLAG_DUMP) != 0 && (kiter->attributes[kiter->i_curr_attribute]->flags & GRIB_ACCESSOR_FLAG_READ_ONLY) == 0)
+    while (kiter->i_curr_attribute < MAX_ACCESSOR_ATTRIBUTES && kiter->attributes_of->attributes[kiter->i_curr_attribute]) {
+        if ((kiter->attributes_of->attributes[kiter->i_curr_attribute]->flags & GRIB_ACCESSOR_FLAG_DUMP) != 0 && (kiter->attributes_of->attributes[kiter->i_curr_attribute]->flags & GRIB_ACCESSOR_FLAG_READ_ONLY) == 0)
             break;
         kiter->i_curr_attribute++;
     }
 
-    if (kiter->attributes[kiter->i_curr_attribute]) {
-        if (!kiter->prefix) {
-            const size_t prefixLenMax = strlen(kiter->current->name) + 10;
-            kiter->prefix = (char*)grib_context_malloc_clear(kiter->current->context, prefixLenMax);
-            r             = (int*)grib_trie_get(kiter->seen, kiter->current->name);
-            snprintf(kiter->prefix, prefixLenMax, "#%d#%s", *r, kiter->current->name);
+    if (kiter->attributes_of->attributes[kiter->i_curr_attribute]) {
+        if (!kiter->has_prefix) {
+            const size_t prefixLenMax = strlen(kiter->current->name) + 16;
+            char* prefix              = reserve(c, kiter->prefix, &kiter->prefix_size, prefixLenMax);
+            if (!prefix)
+                return 0;
+            kiter->prefix = prefix;
+            snprintf(kiter->prefix, prefixLenMax, "#%d#%s", kiter->rank, kiter->current->name);
+            kiter->has_prefix = 1;
         }
         kiter->i_curr_attribute++;
         return 1;
     }
     else {
-        char* prefix = 0;
-        if (!kiter->prefix)
+        const char* name = NULL;
+        char* prefix     = NULL;
+        size_t len       = 0;
+        if (!kiter->has_prefix)
             return 0;
-        if (!kiter->attributes[i_curr_attribute]) {
-            grib_context_free(kiter->current->context, kiter->prefix);
-            kiter->prefix = 0;
+        if (!kiter->attributes_of->attributes[i_curr_attribute]) {
+            kiter->has_prefix = 0;
             return 0;
         }
-        prefix = (char*)grib_context_malloc_clear(kiter->current->context, strlen(kiter->prefix) + strlen(kiter->attributes[i_curr_attribute]->name) + 3);
-        /*sprintf(prefix,"%s->%s",kiter->prefix,kiter->attributes[i_curr_attribute]->name);*/
-        strcpy(prefix, kiter->prefix); /* strcpy and strcat here are much faster than sprintf */
-        strcat(prefix, "->");
-        strcat(prefix, kiter->attributes[i_curr_attribute]->name);
-        grib_context_free(kiter->current->context, kiter->prefix);
-        kiter->prefix           = prefix;
-        kiter->attributes       = kiter->attributes[i_curr_attribute]->attributes;
+        /* The prefix grows in place: #n#key->attribute->attribute... */
+        name   = kiter->attributes_of->attributes[i_curr_attribute]->name;
+        len    = strlen(kiter->prefix);
+        prefix = reserve(c, kiter->prefix, &kiter->prefix_size, len + strlen(name) + 3);
+        if (!prefix)
+            return 0;
+        kiter->prefix = prefix;
+        strcpy(prefix + len, "->");
+        strcpy(prefix + len + 2, name);
+        kiter->attributes_of    = kiter->attributes_of->attributes[i_curr_attribute];
         kiter->i_curr_attribute = 0;
         return next_attribute(kiter);
     }
@@ -160,28 +229,23 @@ static int next_attribute(bufr_keys_iterator* kiter)
 
 int codes_bufr_keys_iterator_next(bufr_keys_iterator* kiter)
 {
-    /* ECC-734: de-allocate last key name stored */
-    grib_context_free(kiter->handle->context, kiter->key_name);
-    kiter->key_name = NULL;
-
     if (kiter->at_start) {
+        if (use_snapshot(kiter) != GRIB_SUCCESS)
+            return 0;
         kiter->current          = kiter->handle->root->block->first;
         kiter->at_start         = 0;
         kiter->i_curr_attribute = 0;
-        kiter->prefix           = 0;
-        kiter->attributes       = 0;
+        kiter->has_prefix       = 0;
+        kiter->attributes_of    = 0;
     }
     else {
         if (next_attribute(kiter)) {
             return 1;
         }
         else {
-            kiter->current    = kiter->current->next_accessor();
-            kiter->attributes = 0;
-            if (kiter->prefix) {
-                grib_context_free(kiter->current->context, kiter->prefix);
-                kiter->prefix = 0;
-            }
+            kiter->current          = kiter->current->next_accessor();
+            kiter->attributes_of    = 0;
+            kiter->has_prefix       = 0;
             kiter->i_curr_attribute = 0;
         }
     }
@@ -192,31 +256,33 @@ int codes_bufr_keys_iterator_next(bufr_keys_iterator* kiter)
     return kiter->current != NULL;
 }
 
-/* The return value is constructed so we allocate memory for it. */
-/* We free in codes_bufr_keys_iterator_delete() */
+/* The name is written into a buffer of the iterator, reused from key to key */
+/* and freed in codes_bufr_keys_iterator_delete() */
 char* codes_bufr_keys_iterator_get_name(const bufr_keys_iterator* ckiter)
 {
     bufr_keys_iterator* kiter = (bufr_keys_iterator*)ckiter;
-    int* r                    = 0;
-    char* ret                 = 0;
     const grib_context* c     = kiter->handle->context;
+    char* ret                 = 0;
     DEBUG_ASSERT(kiter->current);
 
-    if (kiter->prefix) {
-        int iattribute = kiter->i_curr_attribute - 1;
-        ret            = (char*)grib_context_malloc_clear(c, strlen(kiter->prefix) + strlen(kiter->attributes[iattribute]->name) + 10);
-        /*sprintf(ret,"%s->%s",kiter->prefix,kiter->attributes[iattribute]->name);*/
-        strcpy(ret, kiter->prefix); /* strcpy and strcat here are much faster than sprintf */
-        strcat(ret, "->");
-        strcat(ret, kiter->attributes[iattribute]->name);
+    if (kiter->has_prefix) {
+        const char* name = kiter->attributes_of->attributes[kiter->i_curr_attribute - 1]->name;
+        const size_t len = strlen(kiter->prefix);
+        ret              = reserve(c, kiter->key_name, &kiter->key_name_size, len + strlen(name) + 3);
+        if (!ret)
+            return NULL;
+        memcpy(ret, kiter->prefix, len);
+        strcpy(ret + len, "->");
+        strcpy(ret + len + 2, name);
     }
     else {
-        const size_t retMaxLen = strlen(kiter->current->name) + 10;
-        ret = (char*)grib_context_malloc_clear(c, retMaxLen);
+        const size_t retMaxLen = strlen(kiter->current->name) + 16;
+        ret                    = reserve(c, kiter->key_name, &kiter->key_name_size, retMaxLen);
+        if (!ret)
+            return NULL;
 
         if (kiter->current->flags & GRIB_ACCESSOR_FLAG_BUFR_DATA) {
-            r = (int*)grib_trie_get(kiter->seen, kiter->current->name);
-            snprintf(ret, retMaxLen, "#%d#%s", *r, kiter->current->name);
+            snprintf(ret, retMaxLen, "#%d#%s", kiter->rank, kiter->current->name);
         }
         else {
             strcpy(ret, kiter->current->name);
@@ -237,7 +303,9 @@ int codes_bufr_keys_iterator_delete(bufr_keys_iterator* kiter)
 {
     if (kiter) {
         const grib_context* c = kiter->handle->context;
-        kiter->key_name = NULL;
+        grib_context_free(c, kiter->key_name);
+        grib_context_free(c, kiter->prefix);
+        grib_context_free(c, kiter->seen_counts);
         if (kiter->seen)
             grib_trie_delete(kiter->seen);
         grib_context_free(c, kiter);
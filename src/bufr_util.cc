@@ -9,6 +9,8 @@
  */
 
 #include "grib_api_internal.h"
+#include "accessor/grib_accessor_class_bufr_data_array.h"
+#include <type_traits>
 
 // Return the rank of the key using list of keys (For BUFR keys)
 // The argument 'keys' is an input as well as output from each call
@@ -59,6 +61,47 @@ int compute_bufr_key_rank(grib_handle* h, grib_string_list* keys, const char* ke
     return theRank;
 }
 
+// Get #1#key ... #n#key, i.e. the value of key in each subset of an uncompressed message,
+// looking the key up once instead of once per subset. Each must be a single value.
+template <typename T>
+static int bufr_get_subsets_array(const grib_handle* h, const char* key, T* values, long numberOfSubsets)
+{
+    grib_accessor* data = grib_find_accessor(h, "dataAccessors");
+    grib_oarray* objs   = NULL;
+    long i;
+
+    if (!data)
+        return GRIB_NOT_FOUND;
+    objs = grib_trie_with_rank_get_all(accessor_bufr_data_array_get_dataAccessorsTrie(data), key);
+    if (!objs || objs->n < (size_t)numberOfSubsets)
+        return GRIB_NOT_FOUND;
+
+    for (i = 0; i < numberOfSubsets; ++i) {
+        grib_accessor* a = (grib_accessor*)objs->v[i];
+        long count       = 0;
+        size_t len       = 1;
+        int err          = a->value_count(&count);
+        if (err) return err;
+        if (count > 1) return GRIB_NOT_IMPLEMENTED;
+        if constexpr (std::is_same<T, double>::value)
+            err = a->unpack_double(&values[i], &len);
+        else
+            err = a->unpack_long(&values[i], &len);
+        if (err) return err;
+    }
+    return GRIB_SUCCESS;
+}
+
+int bufr_get_subsets_double_array(const grib_handle* h, const char* key, double* values, long numberOfSubsets)
+{
+    return bufr_get_subsets_array<double>(h, key, values, numberOfSubsets);
+}
+
+int bufr_get_subsets_long_array(const grib_handle* h, const char* key, long* values, long numberOfSubsets)
+{
+    return bufr_get_subsets_array<long>(h, key, values, numberOfSubsets);
+}
+
 char** codes_bufr_copy_data_return_copied_keys(grib_handle* hin, grib_handle* hout, size_t* nkeys, int* err)
 {
     bufr_keys_iterator* kiter = NULL;
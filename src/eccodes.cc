@@ -81,6 +81,10 @@ void codes_fieldset_rewind(grib_fieldset* set)
 {
     grib_fieldset_rewind(set);
 }
+int codes_fieldset_apply_where(grib_fieldset* set, const char* where_string)
+{
+    return grib_fieldset_apply_where(set, where_string);
+}
 int codes_fieldset_apply_order_by(grib_fieldset* set, const char* order_by_string)
 {
     return grib_fieldset_apply_order_by(set, order_by_string);
@@ -367,6 +371,10 @@ int codes_get_float_elements(const grib_handle* h, const char* key, const int* i
 {
     return grib_get_float_elements(h, key, index_array, size, value);
 }
+int codes_get_value_bounds(const grib_handle* h, double* lo, double* hi, int* exact)
+{
+    return grib_get_value_bounds(h, lo, hi, exact);
+}
 
 int codes_get_string(const grib_handle* h, const char* key, char* mesg, size_t* length)
 {
@@ -444,6 +452,14 @@ int codes_set_values(grib_handle* h, grib_values* grib_values, size_t arg_count)
 {
     return grib_set_values(h, grib_values, arg_count);
 }
+int codes_set_begin(grib_handle* h)
+{
+    return grib_set_begin(h);
+}
+int codes_set_commit(grib_handle* h)
+{
+    return grib_set_commit(h);
+}
 int codes_get_message_offset(const grib_handle* h, off_t* offset)
 {
     return grib_get_message_offset(h, offset);
@@ -183,6 +183,7 @@ codes_fieldset* codes_fieldset_new_from_files(codes_context* c, const char* file
 
 void codes_fieldset_delete(codes_fieldset* set);
 void codes_fieldset_rewind(codes_fieldset* set);
+int codes_fieldset_apply_where(codes_fieldset* set, const char* where_string);
 int codes_fieldset_apply_order_by(codes_fieldset* set, const char* order_by_string);
 codes_handle* codes_fieldset_next_handle(codes_fieldset* set, int* err);
 int codes_fieldset_count(const codes_fieldset* set);
@@ -790,6 +791,20 @@ int codes_get_float(const codes_handle* h, const char* key, float* value);
 int codes_get_double_element(const codes_handle* h, const char* key, int i, double* value);
 int codes_get_float_element(const codes_handle* h, const char* key, int i, float* value);
 
+/**
+ *  Get bounds of the data values from the packing parameters only, without decoding the data.
+ *  All the values which are not missing lie in [lo, hi]. The bounds are the actual minimum
+ *  and maximum only when exact is set to 1 on return (e.g. constant fields).
+ *  Packings which do not allow it (e.g. IEEE, complex, second-order, spectral) return GRIB_NOT_IMPLEMENTED
+ *
+ * @param h           : the handle to get the data from
+ * @param lo          : the address of a double where the lower bound will be retrieved
+ * @param hi          : the address of a double where the upper bound will be retrieved
+ * @param exact       : the address of an int set to 1 if the bounds are the actual minimum and maximum
+ * @return            0 if OK, integer value on error
+ */
+int codes_get_value_bounds(const codes_handle* h, double* lo, double* hi, int* exact);
+
 /**
  *  Get as double array the elements of the "key" array whose indexes are listed in the input array "index_array"
  *
@@ -1356,6 +1371,12 @@ void codes_check(const char* call, const char* file, int line, int e, const char
 
 
 int codes_set_values(codes_handle* h, codes_values* codes_values, size_t arg_count);
+
+/* Start recording the scalar keys set on the handle (long, double, string, missing).
+   They are applied together by codes_set_commit which rebuilds each affected section once.
+   Setting an array or bytes key applies the values recorded so far first */
+int codes_set_begin(codes_handle* h);
+int codes_set_commit(codes_handle* h);
 codes_handle* codes_handle_new_from_partial_message_copy(codes_context* c, const void* data, size_t size);
 codes_handle* codes_handle_new_from_partial_message(codes_context* c, const void* data, size_t buflen);
 
@@ -13,6 +13,9 @@ int grib_action_execute(grib_action* a, grib_handle* h);
 void grib_dump_action_branch(FILE* out, grib_action* a, int decay);
 void grib_dump_action_tree(grib_context* ctx, FILE* out);
 
+/* action_class_section.cc */
+int grib_section_reparse_deferred(grib_handle* h);
+
 /* action_class_alias.cc */
 grib_action* grib_action_create_alias(grib_context* context, const char* name, const char* arg1, const char* name_space, int flags);
 
@@ -359,6 +362,10 @@ void grib_permanent_free(const grib_context* c, void* p);
 void* grib_buffer_malloc(const grib_context* c, size_t s);
 void grib_buffer_free(const grib_context* c, void* p);
 void* grib_buffer_realloc(const grib_context* c, void* p, size_t s);
+grib_arena* grib_arena_new(grib_context* c);
+void grib_arena_delete(grib_arena* a);
+void* grib_arena_malloc_clear(grib_arena* a, size_t size);
+void grib_arena_free(grib_arena* a, void* p, size_t size);
 
 /* grib_buffer.cc */
 grib_buffer* grib_create_growable_buffer(const grib_context* c);
@@ -444,7 +451,10 @@ void grib_context_set_handle_file_count(grib_context* c, int new_count);
 void grib_context_set_handle_total_count(grib_context* c, int new_count);
 void grib_context_increment_handle_file_count(grib_context* c);
 void grib_context_increment_handle_total_count(grib_context* c);
+void grib_context_set_thread_handle_counts(int file_count, int total_count);
 bufr_descriptors_array* grib_context_expanded_descriptors_list_get(grib_context* c, const char* key, long* u, size_t size);
+const grib_laplacian_scaling* grib_context_laplacian_scaling_get(grib_context* c, long maxv, double laplacianOperator);
+void grib_context_laplacian_scaling_release(grib_context* c, const grib_laplacian_scaling* s);
 void grib_context_expanded_descriptors_list_push(grib_context* c, const char* key, bufr_descriptors_array* expanded, bufr_descriptors_array* unexpanded);
 void codes_set_codes_assertion_failed_proc(codes_assertion_failed_proc proc);
 void codes_assertion_failed(const char* message, const char* file, int line);
@@ -484,7 +494,15 @@ void grib_file_pool_delete_file(grib_file* file);
 void grib_file_close(const char* filename, int force, int* err);
 void grib_file_close_all(int* err);
 grib_file* grib_get_file(const char* filename, int* err);
+void* grib_file_read_message(grib_context* c, grib_file* file, off_t offset, size_t length, int* err);
+grib_handle* grib_file_handle_new(grib_context* c, grib_file* file, off_t offset, size_t length, int* err);
 void grib_file_delete(grib_file* file);
+void grib_output_capture_start(grib_output_capture* oc);
+void grib_output_capture_stop(void);
+grib_output_capture* grib_output_capture_current(void);
+int grib_output_capture_add(grib_output_capture* oc, const char* filename, const char* mode, int pooled, const void* data, size_t length);
+void grib_output_capture_clear(grib_output_capture* oc);
+int grib_output_capture_flush(grib_output_capture* oc);
 
 /* grib_geography.cc */
 int grib_get_gaussian_latitudes(long trunc, double* lats);
@@ -495,6 +513,7 @@ double geographic_distance_spherical(double radius, double lon1, double lat1, do
 
 /* grib_handle.cc */
 grib_section* grib_section_create(grib_handle* h, grib_accessor* owner);
+grib_arena* grib_handle_arena(grib_handle* h);
 void grib_swap_sections(grib_section* the_old, grib_section* the_new);
 void grib_empty_section(grib_context* c, grib_section* b);
 void grib_section_delete(grib_context* c, grib_section* b);
@@ -594,6 +613,7 @@ grib_trie_with_rank* grib_trie_with_rank_new(grib_context* c);
 void grib_trie_with_rank_delete_container(grib_trie_with_rank* t);
 int grib_trie_with_rank_insert(grib_trie_with_rank* t, const char* key, void* data);
 void* grib_trie_with_rank_get(grib_trie_with_rank* t, const char* key, int rank);
+grib_oarray* grib_trie_with_rank_get_all(grib_trie_with_rank* t, const char* key);
 
 /* grib_itrie.cc */
 grib_itrie* grib_itrie_new(grib_context* c, int* count);
@@ -648,11 +668,19 @@ int grib_type_to_int(char id);
 grib_accessors_list* grib_find_accessors_list(const grib_handle* h, const char* name);
 char* grib_split_name_attribute(grib_context* c, const char* name, char* attribute_name);
 grib_accessor* grib_find_accessor(const grib_handle* h, const char* name);
+grib_accessor* grib_find_accessor_by_id(const grib_handle* h, const char* name, int id);
 grib_accessor* grib_find_accessor_fast(grib_handle* h, const char* name);
+grib_accessor* grib_handle_cached_accessor(const grib_handle* h, int id);
+void grib_handle_cache_accessor(grib_handle* h, int id, grib_accessor* a);
+void grib_handle_clear_accessor_cache(grib_handle* h);
+int grib_handle_replace_cached_section(grib_handle* h, grib_section* s, grib_section* from);
 
 /* grib_scaling.cc */
 double grib_power(long s, long n);
 long grib_get_binary_scale_fact(double max, double min, long bpval, int* error);
+int grib_get_packed_value_bounds(grib_handle* h, const char* reference_value, const char* binary_scale_factor,
+                                 const char* decimal_scale_factor, const char* bits_per_value,
+                                 double* lo, double* hi, int* exact);
 
 /* grib_templates.cc */
 grib_handle* codes_external_sample(grib_context* c, ProductKind product_kind, const char* name);
@@ -703,6 +731,7 @@ int grib_get_double(const grib_handle* h, const char* name, double* val);
 int grib_get_double_element_internal(grib_handle* h, const char* name, int i, double* val);
 int grib_get_double_element(const grib_handle* h, const char* name, int i, double* val);
 int grib_get_float_element(const grib_handle* h, const char* name, int i, float* val);
+int grib_get_value_bounds(const grib_handle* h, double* lo, double* hi, int* exact);
 
 int grib_get_double_element_set_internal(grib_handle* h, const char* name, const size_t* index_array, size_t len, double* val_array);
 int grib_get_double_element_set(const grib_handle* h, const char* name, const size_t* index_array, size_t len, double* val_array);
@@ -731,6 +760,9 @@ int grib_get_string_array(const grib_handle* h, const char* name, char** val, si
 int grib_get_long_array_internal(grib_handle* h, const char* name, long* val, size_t* length);
 int grib_get_long_array(const grib_handle* h, const char* name, long* val, size_t* length);
 int grib_set_values(grib_handle* h, grib_values* args, size_t count);
+int grib_set_begin(grib_handle* h);
+int grib_set_commit(grib_handle* h);
+void grib_set_pending_free(grib_handle* h);
 int grib_get_nearest_smaller_value(grib_handle* h, const char* name, double val, double* nearest);
 void grib_print_values(const char* title, grib_values* values, FILE* out);
 int grib_values_check(grib_handle* h, grib_values* values, int count);
@@ -778,6 +810,7 @@ grib_expression* new_is_integer_expression(grib_context* c, const char* name, in
 grib_expression* new_length_expression(grib_context* c, const char* name);
 
 /* grib_expression_class_long.cc */
+int grib_expression_is_long_constant(grib_expression* g, long* value);
 grib_expression* new_long_expression(grib_context* c, long value);
 
 /* grib_expression_class_double.cc */
@@ -875,6 +908,8 @@ int grib_util_grib_data_quality_check(grib_handle* h, double min_val, double max
 
 /* bufr_util.cc */
 int compute_bufr_key_rank(grib_handle* h, grib_string_list* keys, const char* key);
+int bufr_get_subsets_double_array(const grib_handle* h, const char* key, double* values, long numberOfSubsets);
+int bufr_get_subsets_long_array(const grib_handle* h, const char* key, long* values, long numberOfSubsets);
 char** codes_bufr_copy_data_return_copied_keys(grib_handle* hin, grib_handle* hout, size_t* nkeys, int* err);
 int codes_bufr_copy_data(grib_handle* hin, grib_handle* hout);
 int codes_bufr_extract_headers_malloc(grib_context* c, const char* filename, codes_bufr_header** result, int* num_messages, int strict_mode);
@@ -897,6 +932,15 @@ const char* grib_get_type_name(int type);
 char* string_replace_char(char* str, char oldc, char newc);
 void string_remove_char(char* str, char c);
 
+/* grib_output_buffer.cc */
+void grib_output_buffer_init(grib_output_buffer* b, FILE* out);
+void grib_output_buffer_flush(grib_output_buffer* b);
+void grib_output_buffer_write(grib_output_buffer* b, const char* s, size_t len);
+void grib_output_buffer_puts(grib_output_buffer* b, const char* s);
+void grib_output_buffer_indent(grib_output_buffer* b, int width);
+void grib_output_buffer_printf(grib_output_buffer* b, const char* format, const double* values, size_t count);
+void grib_output_buffer_double(grib_output_buffer* b, const char* format, double value);
+
 /* functions.cc */
 long grib_op_eq(long a, long b);
 long grib_op_ne(long a, long b);
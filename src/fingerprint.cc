@@ -0,0 +1,310 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+#include "fingerprint.h"
+#include <stdio.h>
+#include <string.h>
+
+/* ----------------------------------------------------------------------------
+ * XXH3 64-bit, scalar version with the default secret and seed 0.
+ * See https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+ * ------------------------------------------------------------------------- */
+
+static const uint64_t PRIME32_1 = 0x9E3779B1U;
+static const uint64_t PRIME32_2 = 0x85EBCA77U;
+static const uint64_t PRIME32_3 = 0xC2B2AE3DU;
+static const uint64_t PRIME64_1 = 0x9E3779B185EBCA87ULL;
+static const uint64_t PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+static const uint64_t PRIME64_3 = 0x165667B19E3779F9ULL;
+static const uint64_t PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+static const uint64_t PRIME64_5 = 0x27D4EB2F165667C5ULL;
+static const uint64_t PRIME_MX1 = 0x165667919E3779F9ULL;
+static const uint64_t PRIME_MX2 = 0x9FB21C651E98DF25ULL;
+
+#define XXH3_SECRET_SIZE 192
+#define XXH3_STRIPE_LEN 64
+#define XXH3_STRIPES_PER_BLOCK ((XXH3_SECRET_SIZE - XXH3_STRIPE_LEN) / 8)
+#define XXH3_BLOCK_LEN (XXH3_STRIPE_LEN * XXH3_STRIPES_PER_BLOCK)
+
+static const uint8_t xxh3_secret[XXH3_SECRET_SIZE] = {
+    0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+    0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+    0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+    0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+    0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+    0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+    0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+    0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+    0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+    0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+    0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+    0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+};
+
+static inline uint32_t read_le32(const uint8_t* p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline uint64_t read_le64(const uint8_t* p)
+{
+    return (uint64_t)read_le32(p) | ((uint64_t)read_le32(p + 4) << 32);
+}
+
+static inline uint64_t rotl64(uint64_t x, int r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+static inline uint64_t swap64(uint64_t x)
+{
+    x = ((x << 8) & 0xFF00FF00FF00FF00ULL) | ((x >> 8) & 0x00FF00FF00FF00FFULL);
+    x = ((x << 16) & 0xFFFF0000FFFF0000ULL) | ((x >> 16) & 0x0000FFFF0000FFFFULL);
+    return (x << 32) | (x >> 32);
+}
+
+static inline uint64_t mul128_fold64(uint64_t lhs, uint64_t rhs)
+{
+#if defined(__SIZEOF_INT128__)
+    const __uint128_t product = (__uint128_t)lhs * rhs;
+    return (uint64_t)product ^ (uint64_t)(product >> 64);
+#else
+    /* Portable 64x64->128 multiplication */
+    const uint64_t lo_lo = (lhs & 0xFFFFFFFF) * (rhs & 0xFFFFFFFF);
+    const uint64_t hi_lo = (lhs >> 32) * (rhs & 0xFFFFFFFF);
+    const uint64_t lo_hi = (lhs & 0xFFFFFFFF) * (rhs >> 32);
+    const uint64_t hi_hi = (lhs >> 32) * (rhs >> 32);
+    const uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFF) + lo_hi;
+    const uint64_t upper = (hi_lo >> 32) + (cross >> 32) + hi_hi;
+    const uint64_t lower = (cross << 32) | (lo_lo & 0xFFFFFFFF);
+    return lower ^ upper;
+#endif
+}
+
+static inline uint64_t xxh64_avalanche(uint64_t h)
+{
+    h ^= h >> 33;
+    h *= PRIME64_2;
+    h ^= h >> 29;
+    h *= PRIME64_3;
+    h ^= h >> 32;
+    return h;
+}
+
+static inline uint64_t xxh3_avalanche(uint64_t h)
+{
+    h ^= h >> 37;
+    h *= PRIME_MX1;
+    h ^= h >> 32;
+    return h;
+}
+
+static inline uint64_t xxh3_rrmxmx(uint64_t h, uint64_t len)
+{
+    h ^= rotl64(h, 49) ^ rotl64(h, 24);
+    h *= PRIME_MX2;
+    h ^= (h >> 35) + len;
+    h *= PRIME_MX2;
+    return h ^ (h >> 28);
+}
+
+static inline uint64_t xxh3_mix16(const uint8_t* p, const uint8_t* secret)
+{
+    return mul128_fold64(read_le64(p) ^ read_le64(secret), read_le64(p + 8) ^ read_le64(secret + 8));
+}
+
+static uint64_t xxh3_len_0to16(const uint8_t* p, size_t len)
+{
+    const uint8_t* secret = xxh3_secret;
+    if (len > 8) {
+        const uint64_t lo  = read_le64(p) ^ (read_le64(secret + 24) ^ read_le64(secret + 32));
+        const uint64_t hi  = read_le64(p + len - 8) ^ (read_le64(secret + 40) ^ read_le64(secret + 48));
+        const uint64_t acc = len + swap64(lo) + hi + mul128_fold64(lo, hi);
+        return xxh3_avalanche(acc);
+    }
+    if (len >= 4) {
+        const uint64_t input1  = read_le32(p);
+        const uint64_t input2  = read_le32(p + len - 4);
+        const uint64_t bitflip = read_le64(secret + 8) ^ read_le64(secret + 16);
+        return xxh3_rrmxmx((input2 + (input1 << 32)) ^ bitflip, len);
+    }
+    if (len > 0) {
+        const uint32_t combined = ((uint32_t)p[0] << 16) | ((uint32_t)p[len >> 1] << 24) |
+                                  (uint32_t)p[len - 1] | ((uint32_t)len << 8);
+        const uint64_t bitflip  = read_le32(secret) ^ read_le32(secret + 4);
+        return xxh64_avalanche((uint64_t)combined ^ bitflip);
+    }
+    return xxh64_avalanche(read_le64(secret + 56) ^ read_le64(secret + 64));
+}
+
+static uint64_t xxh3_len_17to128(const uint8_t* p, size_t len)
+{
+    const uint8_t* secret = xxh3_secret;
+    uint64_t acc          = len * PRIME64_1;
+    if (len > 32) {
+        if (len > 64) {
+            if (len > 96) {
+                acc += xxh3_mix16(p + 48, secret + 96);
+                acc += xxh3_mix16(p + len - 64, secret + 112);
+            }
+            acc += xxh3_mix16(p + 32, secret + 64);
+            acc += xxh3_mix16(p + len - 48, secret + 80);
+        }
+        acc += xxh3_mix16(p + 16, secret + 32);
+        acc += xxh3_mix16(p + len - 32, secret + 48);
+    }
+    acc += xxh3_mix16(p, secret);
+    acc += xxh3_mix16(p + len - 16, secret + 16);
+    return xxh3_avalanche(acc);
+}
+
+static uint64_t xxh3_len_129to240(const uint8_t* p, size_t len)
+{
+    const uint8_t* secret = xxh3_secret;
+    const size_t nrounds  = len / 16;
+    uint64_t acc          = len * PRIME64_1;
+    uint64_t acc_end;
+    size_t i;
+    for (i = 0; i < 8; i++)
+        acc += xxh3_mix16(p + 16 * i, secret + 16 * i);
+    acc_end = xxh3_mix16(p + len - 16, secret + 136 - 17);
+    acc     = xxh3_avalanche(acc);
+    for (i = 8; i < nrounds; i++)
+        acc_end += xxh3_mix16(p + 16 * i, secret + 16 * (i - 8) + 3);
+    return xxh3_avalanche(acc + acc_end);
+}
+
+static inline void xxh3_accumulate_512(uint64_t* acc, const uint8_t* p, const uint8_t* secret)
+{
+    int i;
+    for (i = 0; i < 8; i++) {
+        const uint64_t data_val = read_le64(p + 8 * i);
+        const uint64_t data_key = data_val ^ read_le64(secret + 8 * i);
+        acc[i ^ 1] += data_val;
+        acc[i] += (data_key & 0xFFFFFFFF) * (data_key >> 32);
+    }
+}
+
+static inline void xxh3_scramble(uint64_t* acc, const uint8_t* secret)
+{
+    int i;
+    for (i = 0; i < 8; i++) {
+        uint64_t a = acc[i];
+        a ^= a >> 47;
+        a ^= read_le64(secret + 8 * i);
+        a *= PRIME32_1;
+        acc[i] = a;
+    }
+}
+
+static uint64_t xxh3_long(const uint8_t* p, size_t len)
+{
+    const uint8_t* secret = xxh3_secret;
+    uint64_t acc[8]       = { PRIME32_3, PRIME64_1, PRIME64_2, PRIME64_3, PRIME64_4, PRIME32_2, PRIME64_5, PRIME32_1 };
+    const size_t nblocks  = (len - 1) / XXH3_BLOCK_LEN;
+    size_t n, s, nstripes;
+    uint64_t result;
+
+    for (n = 0; n < nblocks; n++) {
+        const uint8_t* block = p + n * XXH3_BLOCK_LEN;
+        for (s = 0; s < XXH3_STRIPES_PER_BLOCK; s++)
+            xxh3_accumulate_512(acc, block + s * XXH3_STRIPE_LEN, secret + s * 8);
+        xxh3_scramble(acc, secret + XXH3_SECRET_SIZE - XXH3_STRIPE_LEN);
+    }
+
+    /* Last partial block and last stripe */
+    nstripes = ((len - 1) - XXH3_BLOCK_LEN * nblocks) / XXH3_STRIPE_LEN;
+    for (s = 0; s < nstripes; s++)
+        xxh3_accumulate_512(acc, p + nblocks * XXH3_BLOCK_LEN + s * XXH3_STRIPE_LEN, secret + s * 8);
+    xxh3_accumulate_512(acc, p + len - XXH3_STRIPE_LEN, secret + XXH3_SECRET_SIZE - XXH3_STRIPE_LEN - 7);
+
+    result = len * PRIME64_1;
+    for (n = 0; n < 4; n++)
+        result += mul128_fold64(acc[2 * n] ^ read_le64(secret + 11 + 16 * n),
+                                acc[2 * n + 1] ^ read_le64(secret + 11 + 16 * n + 8));
+    return xxh3_avalanche(result);
+}
+
+uint64_t grib_xxh3_64(const void* data, size_t len)
+{
+    const uint8_t* p = (const uint8_t*)data;
+    if (len <= 16)
+        return xxh3_len_0to16(p, len);
+    if (len <= 128)
+        return xxh3_len_17to128(p, len);
+    if (len <= 240)
+        return xxh3_len_129to240(p, len);
+    return xxh3_long(p, len);
+}
+
+/* ----------------------------------------------------------------------------
+ * CRC-32C (reflected polynomial 0x82F63B78), slicing by 8
+ * ------------------------------------------------------------------------- */
+
+struct crc32c_tables
+{
+    uint32_t t[8][256];
+    crc32c_tables()
+    {
+        uint32_t i, j, c;
+        for (i = 0; i < 256; i++) {
+            c = i;
+            for (j = 0; j < 8; j++)
+                c = (c >> 1) ^ (0x82F63B78U & (0U - (c & 1)));
+            t[0][i] = c;
+        }
+        for (i = 0; i < 256; i++)
+            for (j = 1; j < 8; j++)
+                t[j][i] = (t[j - 1][i] >> 8) ^ t[0][t[j - 1][i] & 0xFF];
+    }
+};
+
+uint32_t grib_crc32c(uint32_t crc, const void* data, size_t len)
+{
+    static const crc32c_tables tables; /* Thread-safe initialisation */
+    const uint32_t(*t)[256] = tables.t;
+    const uint8_t* p        = (const uint8_t*)data;
+
+    crc = ~crc;
+    while (len >= 8) {
+        const uint32_t lo = read_le32(p) ^ crc;
+        const uint32_t hi = read_le32(p + 4);
+        crc = t[7][lo & 0xFF] ^ t[6][(lo >> 8) & 0xFF] ^ t[5][(lo >> 16) & 0xFF] ^ t[4][lo >> 24] ^
+              t[3][hi & 0xFF] ^ t[2][(hi >> 8) & 0xFF] ^ t[1][(hi >> 16) & 0xFF] ^ t[0][hi >> 24];
+        p += 8;
+        len -= 8;
+    }
+    while (len--)
+        crc = (crc >> 8) ^ t[0][(crc ^ *p++) & 0xFF];
+    return ~crc;
+}
+
+/* ------------------------------------------------------------------------- */
+
+int grib_fingerprint_type_from_name(const char* name, grib_fingerprint_type* type)
+{
+    if (strcmp(name, "xxh3") == 0) {
+        *type = GRIB_FINGERPRINT_XXH3;
+        return 0;
+    }
+    if (strcmp(name, "crc32c") == 0) {
+        *type = GRIB_FINGERPRINT_CRC32C;
+        return 0;
+    }
+    return -1;
+}
+
+void grib_fingerprint(grib_fingerprint_type type, const void* data, size_t len, char* hex)
+{
+    if (type == GRIB_FINGERPRINT_CRC32C)
+        snprintf(hex, GRIB_FINGERPRINT_MAX_LEN, "%08x", (unsigned)grib_crc32c(0, data, len));
+    else
+        snprintf(hex, GRIB_FINGERPRINT_MAX_LEN, "%016llx", (unsigned long long)grib_xxh3_64(data, len));
+}
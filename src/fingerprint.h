@@ -0,0 +1,40 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+#ifndef fingerprint_H
+#define fingerprint_H
+
+#include <stdlib.h>
+#include <stdint.h>
+
+/* Fast non-cryptographic fingerprints of messages and sections */
+
+/* XXH3 64-bit hash (seed 0), as XXH3_64bits() of the xxHash library */
+uint64_t grib_xxh3_64(const void* data, size_t len);
+
+/* CRC-32C (Castagnoli). Start with crc=0 and pass the result to continue over more data */
+uint32_t grib_crc32c(uint32_t crc, const void* data, size_t len);
+
+typedef enum grib_fingerprint_type
+{
+    GRIB_FINGERPRINT_XXH3,
+    GRIB_FINGERPRINT_CRC32C
+} grib_fingerprint_type;
+
+/* Parse "xxh3" or "crc32c". Returns 0 if known, -1 otherwise */
+int grib_fingerprint_type_from_name(const char* name, grib_fingerprint_type* type);
+
+/* Size of the hexadecimal fingerprint including the terminating null */
+#define GRIB_FINGERPRINT_MAX_LEN 17
+
+/* Hexadecimal fingerprint of data into hex (at least GRIB_FINGERPRINT_MAX_LEN bytes) */
+void grib_fingerprint(grib_fingerprint_type type, const void* data, size_t len, char* hex);
+
+#endif
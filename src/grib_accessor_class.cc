@@ -75,28 +75,31 @@ static struct table_entry table[] = {
 grib_section* grib_create_root_section(const grib_context* context, grib_handle* h)
 {
     char* fpath     = 0;
-    grib_section* s = (grib_section*)grib_context_malloc_clear(context, sizeof(grib_section));
-
-    GRIB_MUTEX_INIT_ONCE(&once, &init);
-    GRIB_MUTEX_LOCK(&mutex1);
-    if (h->context->grib_reader == NULL) {
-        if ((fpath = grib_context_full_defs_path(h->context, "boot.def")) == NULL) {
-            grib_context_log(h->context, GRIB_LOG_FATAL,
-                             "Unable to find boot.def. Context path=%s\n"
-                             "\nPossible causes:\n"
-                             "- The software is not correctly installed\n"
-                             "- The environment variable ECCODES_DEFINITION_PATH is defined but incorrect\n",
-                             context->grib_definition_files_path);
+    grib_section* s = (grib_section*)grib_arena_malloc_clear(grib_handle_arena(h), sizeof(grib_section));
+
+    if (!h->context->grib_reader_ready.load(std::memory_order_acquire)) {
+        GRIB_MUTEX_INIT_ONCE(&once, &init);
+        GRIB_MUTEX_LOCK(&mutex1);
+        if (h->context->grib_reader == NULL) {
+            if ((fpath = grib_context_full_defs_path(h->context, "boot.def")) == NULL) {
+                grib_context_log(h->context, GRIB_LOG_FATAL,
+                                 "Unable to find boot.def. Context path=%s\n"
+                                 "\nPossible causes:\n"
+                                 "- The software is not correctly installed\n"
+                                 "- The environment variable ECCODES_DEFINITION_PATH is defined but incorrect\n",
+                                 context->grib_definition_files_path);
+            }
+            grib_parse_file(h->context, fpath);
         }
-        grib_parse_file(h->context, fpath);
+        h->context->grib_reader_ready.store(1, std::memory_order_release);
+        GRIB_MUTEX_UNLOCK(&mutex1);
     }
-    GRIB_MUTEX_UNLOCK(&mutex1);
 
     s->h        = h;
     s->aclength = NULL;
     s->owner    = NULL;
     s->block    = (grib_block_of_accessors*)
-        grib_context_malloc_clear(context, sizeof(grib_block_of_accessors));
+        grib_arena_malloc_clear(grib_handle_arena(h), sizeof(grib_block_of_accessors));
     grib_context_log(context, GRIB_LOG_DEBUG, "Creating root section");
     return s;
 }
@@ -140,13 +143,13 @@ grib_accessor* grib_accessor_factory(grib_section* p, grib_action* creator,
     c = *((grib_accessor_classes_hash(creator->op, strlen(creator->op)))->cclass);
 #endif
 
-    a = c->create_empty_accessor();
+    a = c->create_empty_accessor(p->h);
 
     a->name       = creator->name;
     a->name_space = creator->name_space;
 
-    a->all_names[0]       = creator->name;
-    a->all_name_spaces[0] = creator->name_space;
+    a->all_names.set(p->h->context, 0, creator->name);
+    a->all_name_spaces.set(p->h->context, 0, creator->name_space);
 
     a->creator  = creator;
     a->context  = p->h->context;
@@ -251,11 +254,11 @@ void grib_push_accessor(grib_accessor* a, grib_block_of_accessors* l)
         if (*(a->all_names[0]) != '_') {
             id = grib_hash_keys_get_id(a->context->keys, a->all_names[0]);
 
-            DEBUG_ASSERT(id >= 0 && id < ACCESSORS_ARRAY_SIZE);
+            DEBUG_ASSERT(id > 0);
 
-            a->same = hand->accessors[id];
+            a->same = grib_handle_cached_accessor(hand, id);
             link_same_attributes(a, a->same);
-            hand->accessors[id] = a;
+            grib_handle_cache_accessor(hand, id, a);
 
             if (a->same == a) {
                 fprintf(stderr, "---> %s\n", a->name);
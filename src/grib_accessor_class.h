@@ -15,6 +15,7 @@ extern grib_accessor_class* grib_accessor_class_bufr_elements_table;
 extern grib_accessor_class* grib_accessor_class_bufr_extract_area_subsets;
 extern grib_accessor_class* grib_accessor_class_bufr_extract_datetime_subsets;
 extern grib_accessor_class* grib_accessor_class_bufr_extract_subsets;
+extern grib_accessor_class* grib_accessor_class_bufr_grid_box_thinning;
 extern grib_accessor_class* grib_accessor_class_bufr_group;
 extern grib_accessor_class* grib_accessor_class_bufr_simple_thinning;
 extern grib_accessor_class* grib_accessor_class_bufr_string_values;
@@ -23,6 +24,7 @@ extern grib_accessor_class* grib_accessor_class_bytes;
 extern grib_accessor_class* grib_accessor_class_change_alternative_row_scanning;
 extern grib_accessor_class* grib_accessor_class_change_scanning_direction;
 extern grib_accessor_class* grib_accessor_class_check_internal_version;
+extern grib_accessor_class* grib_accessor_class_checksum;
 extern grib_accessor_class* grib_accessor_class_closest_date;
 extern grib_accessor_class* grib_accessor_class_codeflag;
 extern grib_accessor_class* grib_accessor_class_codetable;
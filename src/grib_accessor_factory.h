@@ -14,6 +14,7 @@
 { "bufr_extract_area_subsets", &grib_accessor_class_bufr_extract_area_subsets, },
 { "bufr_extract_datetime_subsets", &grib_accessor_class_bufr_extract_datetime_subsets, },
 { "bufr_extract_subsets", &grib_accessor_class_bufr_extract_subsets, },
+{ "bufr_grid_box_thinning", &grib_accessor_class_bufr_grid_box_thinning, },
 { "bufr_group", &grib_accessor_class_bufr_group, },
 { "bufr_simple_thinning", &grib_accessor_class_bufr_simple_thinning, },
 { "bufr_string_values", &grib_accessor_class_bufr_string_values, },
@@ -22,6 +23,7 @@
 { "change_alternative_row_scanning", &grib_accessor_class_change_alternative_row_scanning, },
 { "change_scanning_direction", &grib_accessor_class_change_scanning_direction, },
 { "check_internal_version", &grib_accessor_class_check_internal_version, },
+{ "checksum", &grib_accessor_class_checksum, },
 { "closest_date", &grib_accessor_class_closest_date, },
 { "codeflag", &grib_accessor_class_codeflag, },
 { "codetable", &grib_accessor_class_codetable, },
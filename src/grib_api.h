@@ -229,6 +229,7 @@ typedef struct bufr_descriptors_map_list bufr_descriptors_map_list;
 grib_fieldset* grib_fieldset_new_from_files(grib_context* c, const char* filenames[], int nfiles, const char** keys, int nkeys, const char* where_string, const char* order_by_string, int* err);
 void grib_fieldset_delete(grib_fieldset* set);
 void grib_fieldset_rewind(grib_fieldset* set);
+int grib_fieldset_apply_where(grib_fieldset* set, const char* where_string);
 int grib_fieldset_apply_order_by(grib_fieldset* set, const char* order_by_string);
 grib_handle* grib_fieldset_next_handle(grib_fieldset* set, int* err);
 int grib_fieldset_count(const grib_fieldset* set);
@@ -798,6 +799,20 @@ int grib_get_float(const grib_handle* h, const char* key, float* value);
 int grib_get_double_element(const grib_handle* h, const char* key, int i, double* value);
 int grib_get_float_element(const grib_handle* h, const char* key, int i, float* value);
 
+/**
+ *  Get bounds of the data values from the packing parameters only, without decoding the data.
+ *  All the values which are not missing lie in [lo, hi]. The bounds are the actual minimum
+ *  and maximum only when exact is set to 1 on return (e.g. constant fields).
+ *  Packings which do not allow it (e.g. IEEE, complex, second-order, spectral) return GRIB_NOT_IMPLEMENTED
+ *
+ * @param h           : the handle to get the data from
+ * @param lo          : the address of a double where the lower bound will be retrieved
+ * @param hi          : the address of a double where the upper bound will be retrieved
+ * @param exact       : the address of an int set to 1 if the bounds are the actual minimum and maximum
+ * @return            0 if OK, integer value on error
+ */
+int grib_get_value_bounds(const grib_handle* h, double* lo, double* hi, int* exact);
+
 /**
  *  Get as double array the elements of the "key" array whose indexes are listed in the input array "index_array"
  *
@@ -1344,6 +1359,12 @@ void grib_check(const char* call, const char* file, int line, int e, const char*
 #define GRIB_CHECK_NOLINE(a, msg) grib_check(#a, 0, 0, a, msg)
 
 int grib_set_values(grib_handle* h, grib_values* grib_values, size_t arg_count);
+
+/* Start recording the scalar keys set on the handle (long, double, string, missing).
+   They are applied together by grib_set_commit which rebuilds each affected section once.
+   Setting an array or bytes key applies the values recorded so far first */
+int grib_set_begin(grib_handle* h);
+int grib_set_commit(grib_handle* h);
 grib_handle* grib_handle_new_from_partial_message_copy(grib_context* c, const void* data, size_t size);
 grib_handle* grib_handle_new_from_partial_message(grib_context* c, const void* data, size_t buflen);
 
@@ -17,6 +17,7 @@
 #define grib_api_internal_H
 
 #ifdef __cplusplus
+#include <atomic>
 extern "C" {
 #endif
 
@@ -194,7 +195,6 @@ extern int pthread_mutexattr_settype(pthread_mutexattr_t* attr, int type);
 
 #define MAX_ACCESSOR_ATTRIBUTES 20
 #define MAX_FILE_HANDLES_WITH_MULTI 10
-#define ACCESSORS_ARRAY_SIZE 5000
 #define MAX_NUM_CONCEPTS 2000
 #define MAX_NUM_HASH_ARRAY 2000
 
@@ -253,6 +253,7 @@ typedef struct grib_nearest_class grib_nearest_class;
 typedef struct grib_dumper grib_dumper;
 typedef struct grib_dumper_class grib_dumper_class;
 typedef struct grib_dependency grib_dependency;
+typedef struct grib_arena grib_arena;
 
 typedef struct codes_condition codes_condition;
 
@@ -373,7 +374,7 @@ struct grib_action_class
     const char* name;          /** < name of the behaviour class */
     size_t size;               /** < size in bytes of the structure */
 
-    int inited;
+    std::atomic<int> inited;
     action_init_class_proc init_class;
 
     action_init_proc init;
@@ -464,7 +465,7 @@ struct grib_iterator_class
     grib_iterator_class** super;
     const char* name;
     size_t size;
-    int inited;
+    std::atomic<int> inited;
     iterator_init_class_proc init_class;
     iterator_init_proc       init;
     iterator_destroy_proc    destroy;
@@ -689,6 +690,18 @@ struct bufr_descriptors_map_list
     bufr_descriptors_map_list* next;
 };
 
+/* Spectral complex packing: Laplacian scaling factors for wavenumbers 0..maxv-1 */
+typedef struct grib_laplacian_scaling grib_laplacian_scaling;
+struct grib_laplacian_scaling
+{
+    long maxv;
+    double laplacianOperator;
+    double* pack;   /* pow(n*(n+1), laplacianOperator) */
+    double* unpack; /* 1/pow(n*(n+1), laplacianOperator) */
+    int cached;     /* Owned by the context */
+    grib_laplacian_scaling* next;
+};
+
 /* BUFR: Operator 203YYY: Linked list storing Table B changed reference values */
 typedef struct bufr_tableb_override bufr_tableb_override;
 struct bufr_tableb_override
@@ -698,6 +711,22 @@ struct bufr_tableb_override
     long new_ref_val;
 };
 
+/* BUFR: Flat snapshot of the data keys, built once after the keys are created.
+ * The accessors are in the order they were created and point into the sorted table of names */
+typedef struct bufr_keys_snapshot_entry
+{
+    const grib_accessor* accessor;
+    size_t name_index;
+} bufr_keys_snapshot_entry;
+
+typedef struct bufr_keys_snapshot
+{
+    bufr_keys_snapshot_entry* entries;
+    size_t n;
+    const char** names;
+    size_t nnames;
+} bufr_keys_snapshot;
+
 struct codes_condition
 {
     char* left;
@@ -712,6 +741,21 @@ void codes_assertion_failed(const char* message, const char* file, int line);
 #define MAX_SET_VALUES 10
 #define MAX_ACCESSOR_CACHE 100
 
+/* A section reparse postponed until the end of a set transaction */
+typedef struct grib_deferred_reparse
+{
+    grib_action* act;
+    grib_accessor* notified;
+    int changing_edition;
+} grib_deferred_reparse;
+
+/* Slot of the per-handle accessor lookup cache (open addressing, see grib_query.cc) */
+typedef struct grib_accessor_cache_entry
+{
+    int id; /* Key id, 0 for an empty slot */
+    grib_accessor* accessor;
+} grib_accessor_cache_entry;
+
 struct grib_handle
 {
     grib_context* context;         /** < context attached to this handle */
@@ -730,7 +774,9 @@ struct grib_handle
     size_t gts_header_len;
     int use_trie;
     int trie_invalid;
-    grib_accessor* accessors[ACCESSORS_ARRAY_SIZE];
+    grib_accessor_cache_entry* accessors; /** Lookup cache: key id -> last accessor with that name */
+    size_t accessors_size;                /** Number of slots, zero or a power of two */
+    size_t accessors_count;               /** Number of slots in use */
     char* section_offset[MAX_NUM_SECTIONS];
     char* section_length[MAX_NUM_SECTIONS];
     int sections_count;
@@ -738,6 +784,16 @@ struct grib_handle
     /* grib_accessor* groups[MAX_NUM_GROUPS]; */
     ProductKind product_kind;
     /* grib_trie* bufr_elements_table; */
+    grib_values* set_pending;          /** Values recorded between grib_set_begin and grib_set_commit */
+    size_t set_pending_count;
+    size_t set_pending_size;
+    int set_recording;                 /** Scalar sets are recorded, not applied */
+    int set_deferring;                 /** Section reparses are deferred (grib_set_commit) */
+    grib_accessor* set_current;        /** Key being set by grib_set_values */
+    grib_deferred_reparse* deferred;   /** Pending section reparses */
+    size_t deferred_count;
+    size_t deferred_size;
+    grib_arena* arena;                 /** Accessors, sections and dependencies (see grib_handle_arena) */
 };
 
 /* For GRIB2 multi-field messages */
@@ -820,6 +876,7 @@ struct grib_context
     char* grib_concept_path;
 
     grib_action_file_list* grib_reader;
+    std::atomic<int> grib_reader_ready; /* boot.def fully parsed into grib_reader */
     void* user_data;
     int real_mode;
 
@@ -843,7 +900,7 @@ struct grib_context
     grib_log_proc output_log;
     grib_print_proc print;
 
-    grib_codetable* codetable;
+    std::atomic<grib_codetable*> codetable;
     grib_smart_table* smart_table;
     char* outfilename;
     int multi_support_on;
@@ -860,10 +917,10 @@ struct grib_context
     int keys_count;
     grib_itrie* concepts_index;
     int concepts_count;
-    grib_concept_value* concepts[MAX_NUM_CONCEPTS];
+    std::atomic<grib_concept_value*> concepts[MAX_NUM_CONCEPTS];
     grib_itrie* hash_array_index;
     int hash_array_count;
-    grib_hash_array_value* hash_array[MAX_NUM_HASH_ARRAY];
+    std::atomic<grib_hash_array_value*> hash_array[MAX_NUM_HASH_ARRAY];
     grib_trie* def_files;
     grib_string_list* blocklist;
     int ieee_packing; /* 32 or 64 */
@@ -877,6 +934,8 @@ struct grib_context
     grib_trie* lists;
     grib_trie* expanded_descriptors;
     int file_pool_max_opened_files;
+    std::atomic<grib_laplacian_scaling*> laplacian_scalings; /* Only complete tables are added */
+    int laplacian_scalings_count;
 #if GRIB_PTHREADS
     pthread_mutex_t mutex;
 #elif GRIB_OMP_THREADS
@@ -955,6 +1014,12 @@ struct grib_file
     long refcount;
     grib_file* next;
     short id;
+    unsigned long hash;   /* hash of name, see grib_file_open */
+    grib_file* hash_next; /* next file in the same pool bucket */
+    grib_file* lru_prev;  /* open files, most recently used first */
+    grib_file* lru_next;
+    int readers;          /* concurrent grib_file_read_message calls; such a file is never evicted */
+    int users;            /* grib_file_open calls not yet closed; such a file is never evicted */
 };
 
 struct grib_file_pool
@@ -965,18 +1030,59 @@ struct grib_file_pool
     size_t size;
     int number_of_opened_files;
     int max_opened_files;
+    grib_file** buckets;
+    size_t nbuckets;
+    grib_file* lru_first;
+    grib_file* lru_last;
+};
+
+/* Output of a message held back while its thread captures it, see
+ * grib_output_capture_start. filename NULL means stdout */
+typedef struct grib_output_record grib_output_record;
+struct grib_output_record
+{
+    char* filename;
+    char mode[4];
+    int pooled; /* written through grib_file_open rather than fopen */
+    unsigned char* data;
+    size_t length;
+    grib_output_record* next;
 };
 
+typedef struct grib_output_capture
+{
+    grib_context* context;
+    grib_output_record* first;
+    grib_output_record* last;
+} grib_output_capture;
+
 /* fieldset */
 typedef struct grib_field grib_field;
 typedef struct grib_column grib_column;
 typedef struct grib_fields grib_fields;
 typedef struct grib_int_array grib_int_array;
 
+typedef struct grib_where_op grib_where_op;
+
+/* One instruction of a compiled where-clause (postfix order) */
+struct grib_where_op
+{
+    int code;      /* GRIB_WHERE_OP_* */
+    int idkey;     /* column index for comparisons */
+    int cmp;       /* GRIB_WHERE_CMP_* */
+    long lval;
+    double dval;
+    char* sval;
+};
+
 struct grib_where
 {
     grib_context* context;
     char* string;
+    grib_where_op* ops;
+    size_t nops;
+    size_t ops_size;
+    int depth; /* maximum evaluation stack depth */
 };
 
 struct grib_column
@@ -1144,7 +1250,7 @@ struct grib_keys_iterator
     int at_start;
     int match;
     int i_curr_attribute;
-    grib_accessor** attributes;
+    grib_accessor* attributes_of; /* accessor whose attributes are being visited */
     char* prefix;
     grib_trie* seen;
 };
@@ -1161,9 +1267,17 @@ struct bufr_keys_iterator
     int at_start;
     int match;
     int i_curr_attribute;
-    grib_accessor** attributes;
-    char* prefix;
-    grib_trie* seen;
+    grib_accessor* attributes_of; /* accessor whose attributes are being visited */
+    char* prefix;                        /* #n#key->attribute... of the attribute being visited */
+    int has_prefix;
+    grib_trie* seen;                     /* occurrences of the keys not in the snapshot */
+    const bufr_keys_snapshot* snapshot;  /* data keys */
+    size_t snapshot_next;                /* entry of the snapshot expected next */
+    int* seen_counts;                    /* occurrences of each name of the snapshot */
+    size_t seen_counts_size;
+    int rank;                            /* rank of the current key */
+    size_t key_name_size;
+    size_t prefix_size;
 };
 
 /* --------- md5 --------*/
@@ -1281,6 +1395,16 @@ typedef struct j2k_encode_helper
 
 } j2k_encode_helper;
 
+/* Text written in large blocks, see grib_output_buffer.cc */
+#define GRIB_OUTPUT_BUFFER_SIZE 32768
+typedef struct grib_output_buffer
+{
+    FILE* out;
+    int fast_format; /* decimal point is '.': numbers need not go through printf */
+    size_t len;
+    char data[GRIB_OUTPUT_BUFFER_SIZE];
+} grib_output_buffer;
+
 #include "eccodes_prototypes.h"
 
 #ifdef __cplusplus
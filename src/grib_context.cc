@@ -292,6 +292,7 @@ static grib_context default_grib_context = {
     0,               /* grib_samples_path          */
     0,               /* grib_concept_path          */
     0,               /* grib_reader                */
+    0,               /* grib_reader_ready          */
     0,               /* user data                  */
     CODES_REAL_MODE8, /* real mode for fortran     */
 
@@ -362,7 +363,9 @@ static grib_context default_grib_context = {
     0,              /* classes                    */
     0,              /* lists                      */
     0,              /* expanded_descriptors       */
-    DEFAULT_FILE_POOL_MAX_OPENED_FILES /* file_pool_max_opened_files */
+    DEFAULT_FILE_POOL_MAX_OPENED_FILES, /* file_pool_max_opened_files */
+    0,              /* laplacian_scalings         */
+    0               /* laplacian_scalings_count   */
 #if GRIB_PTHREADS
     ,
     PTHREAD_MUTEX_INITIALIZER /* mutex */
@@ -372,8 +375,14 @@ static grib_context default_grib_context = {
 /* Hopefully big enough. Note: Definitions and samples path environment variables can contain SEVERAL colon-separated directories */
 #define ECC_PATH_MAXLEN 8192
 
+/* Set once the default context is initialised so later calls need not lock */
+static std::atomic<int> default_grib_context_ready{0};
+
 grib_context* grib_context_get_default()
 {
+    if (default_grib_context_ready.load(std::memory_order_acquire))
+        return &default_grib_context;
+
     GRIB_MUTEX_INIT_ONCE(&once, &init);
     GRIB_MUTEX_LOCK(&mutex_c);
 
@@ -555,6 +564,7 @@ grib_context* grib_context_get_default()
         default_grib_context.file_pool_max_opened_files = file_pool_max_opened_files ? atoi(file_pool_max_opened_files) : DEFAULT_FILE_POOL_MAX_OPENED_FILES;
     }
 
+    default_grib_context_ready.store(1, std::memory_order_release);
     GRIB_MUTEX_UNLOCK(&mutex_c);
     return &default_grib_context;
 }
@@ -689,6 +699,7 @@ char* grib_context_full_defs_path(grib_context* c, const char* basename)
     char full[1024] = {0,};
     grib_string_list* dir      = NULL;
     grib_string_list* fullpath = 0;
+    grib_string_list* found    = 0;
     if (!c)
         c = grib_context_get_default();
 
@@ -698,9 +709,8 @@ char* grib_context_full_defs_path(grib_context* c, const char* basename)
         return (char*)basename;
     }
     else {
-        GRIB_MUTEX_LOCK(&mutex_c); /* See ECC-604 */
+        /* The trie lookup is lock-free (see ECC-604) */
         fullpath = (grib_string_list*)grib_trie_get(c->def_files, basename);
-        GRIB_MUTEX_UNLOCK(&mutex_c);
         if (fullpath != NULL) {
             return fullpath->value;
         }
@@ -723,10 +733,15 @@ char* grib_context_full_defs_path(grib_context* c, const char* basename)
                 Assert(fullpath);
                 fullpath->value = grib_context_strdup(c, full);
                 GRIB_MUTEX_LOCK(&mutex_c);
-                grib_trie_insert(c->def_files, basename, fullpath);
+                found = (grib_string_list*)grib_trie_insert_no_replace(c->def_files, basename, fullpath);
                 grib_context_log(c, GRIB_LOG_DEBUG, "Found def file %s", full);
                 GRIB_MUTEX_UNLOCK(&mutex_c);
-                return fullpath->value;
+                if (found != fullpath) {
+                    /* Another thread got there first */
+                    grib_context_free(c, fullpath->value);
+                    grib_context_free_persistent(c, fullpath);
+                }
+                return found->value;
             } else {
                 grib_context_log(c, GRIB_LOG_DEBUG, "Nonexistent def file %s", full);
             }
@@ -800,6 +815,7 @@ void grib_context_reset(grib_context* c)
     }
 
     c->grib_reader = NULL;
+    c->grib_reader_ready.store(0, std::memory_order_release);
 
     if (c->codetable)
         grib_codetable_delete(c);
@@ -858,7 +874,17 @@ void grib_context_delete(grib_context* c)
     grib_trie_delete(c->expanded_descriptors);
     c->expanded_descriptors=0;
 
+    while (c->laplacian_scalings) {
+        grib_laplacian_scaling* p = c->laplacian_scalings;
+        c->laplacian_scalings     = p->next;
+        p->cached                 = 0;
+        grib_context_laplacian_scaling_release(c, p);
+    }
+    c->laplacian_scalings_count = 0;
+
     c->inited = 0;
+    if (c == &default_grib_context)
+        default_grib_context_ready.store(0, std::memory_order_release);
 }
 
 void codes_bufr_multi_element_constant_arrays_on(grib_context* c)
@@ -1090,9 +1116,22 @@ void grib_context_print(const grib_context* c, void* descriptor, const char* fmt
     c->print(c, descriptor, msg);
 }
 
+/* Message counts seen by a thread processing messages read by another one.
+ * Negative means the counts of the context apply */
+static thread_local int thread_handle_file_count  = -1;
+static thread_local int thread_handle_total_count = -1;
+
+void grib_context_set_thread_handle_counts(int file_count, int total_count)
+{
+    thread_handle_file_count  = file_count;
+    thread_handle_total_count = total_count;
+}
+
 int grib_context_get_handle_file_count(grib_context* c)
 {
     int r = 0;
+    if (thread_handle_file_count >= 0)
+        return thread_handle_file_count;
     if (!c)
         c = grib_context_get_default();
     GRIB_MUTEX_INIT_ONCE(&once, &init);
@@ -1104,6 +1143,8 @@ int grib_context_get_handle_file_count(grib_context* c)
 int grib_context_get_handle_total_count(grib_context* c)
 {
     int r = 0;
+    if (thread_handle_total_count >= 0)
+        return thread_handle_total_count;
     if (!c)
         c = grib_context_get_default();
     GRIB_MUTEX_INIT_ONCE(&once, &init);
@@ -1151,6 +1192,83 @@ void grib_context_increment_handle_total_count(grib_context* c)
     GRIB_MUTEX_UNLOCK(&mutex_c);
 }
 
+/* Only a handful of truncation/operator pairs are used by a given data set.
+ * Fields packed with a computed operator get their own (uncached) tables once this is reached */
+#define MAX_LAPLACIAN_SCALINGS 32
+
+static grib_laplacian_scaling* laplacian_scaling_new(grib_context* c, long maxv, double laplacianOperator)
+{
+    long i                    = 0;
+    grib_laplacian_scaling* s = (grib_laplacian_scaling*)grib_context_malloc_clear(c, sizeof(grib_laplacian_scaling));
+    if (!s)
+        return NULL;
+    s->maxv              = maxv;
+    s->laplacianOperator = laplacianOperator;
+    s->pack              = (double*)grib_context_malloc(c, maxv * sizeof(double));
+    s->unpack            = (double*)grib_context_malloc(c, maxv * sizeof(double));
+    if (!s->pack || !s->unpack) {
+        grib_context_laplacian_scaling_release(c, s);
+        return NULL;
+    }
+
+    s->pack[0]   = 0;
+    s->unpack[0] = 0;
+    for (i = 1; i < maxv; i++) {
+        double operat = pow((double)(i * (i + 1)), laplacianOperator);
+        s->pack[i]    = operat;
+        if (operat != 0)
+            s->unpack[i] = 1.0 / operat;
+        else {
+            grib_context_log(c, GRIB_LOG_WARNING,
+                             "Laplacian scaling: Problem with operator div by zero at index %ld of %ld", i, maxv);
+            s->unpack[i] = 0;
+        }
+    }
+    return s;
+}
+
+const grib_laplacian_scaling* grib_context_laplacian_scaling_get(grib_context* c, long maxv, double laplacianOperator)
+{
+    grib_laplacian_scaling* s = NULL;
+    if (!c)
+        c = grib_context_get_default();
+
+    /* Tables are only added to the cache once built so it can be searched without the lock */
+    for (s = c->laplacian_scalings.load(std::memory_order_acquire); s; s = s->next) {
+        if (s->maxv == maxv && s->laplacianOperator == laplacianOperator)
+            return s;
+    }
+
+    GRIB_MUTEX_INIT_ONCE(&once, &init);
+    GRIB_MUTEX_LOCK(&mutex_c);
+
+    /* Another thread may have built it meanwhile */
+    for (s = c->laplacian_scalings; s; s = s->next) {
+        if (s->maxv == maxv && s->laplacianOperator == laplacianOperator)
+            break;
+    }
+    if (!s && (s = laplacian_scaling_new(c, maxv, laplacianOperator)) != NULL &&
+        c->laplacian_scalings_count < MAX_LAPLACIAN_SCALINGS) {
+        s->cached = 1;
+        s->next   = c->laplacian_scalings;
+        c->laplacian_scalings.store(s, std::memory_order_release);
+        c->laplacian_scalings_count++;
+    }
+
+    GRIB_MUTEX_UNLOCK(&mutex_c);
+    return s;
+}
+
+void grib_context_laplacian_scaling_release(grib_context* c, const grib_laplacian_scaling* s)
+{
+    grib_laplacian_scaling* p = (grib_laplacian_scaling*)s;
+    if (!p || p->cached)
+        return;
+    grib_context_free(c, p->pack);
+    grib_context_free(c, p->unpack);
+    grib_context_free(c, p);
+}
+
 bufr_descriptors_array* grib_context_expanded_descriptors_list_get(grib_context* c, const char* key, long* u, size_t size)
 {
     bufr_descriptors_map_list* expandedUnexpandedMapList;
@@ -74,7 +74,7 @@ void grib_dependency_add(grib_accessor* observer, grib_accessor* observed)
 //         d = d->next;
 //     }
 
-    d = (grib_dependency*)grib_context_malloc_clear(h->context, sizeof(grib_dependency));
+    d = (grib_dependency*)grib_arena_malloc_clear(grib_handle_arena(h), sizeof(grib_dependency));
     Assert(d);
 
     d->observed = observed;
@@ -125,6 +125,31 @@ static int destroy(grib_dumper* d)
     return GRIB_SUCCESS;
 }
 
+/* The elements of an array, cols+1 per line. Written in large blocks as arrays can be long */
+static void dump_double_array(grib_dumper_bufr_simple* self, const double* values, size_t size, int cols)
+{
+    grib_context* c         = self->dumper.context;
+    grib_output_buffer* out = (grib_output_buffer*)grib_context_malloc(c, sizeof(grib_output_buffer));
+    size_t i;
+    int icount = 0;
+
+    grib_output_buffer_init(out, self->dumper.out);
+    for (i = 0; i < size - 1; ++i) {
+        if (icount > cols || i == 0) {
+            grib_output_buffer_puts(out, "\n      ");
+            icount = 0;
+        }
+        grib_output_buffer_double(out, "%g, ", values[i]);
+        icount++;
+    }
+    if (icount > cols || i == 0) {
+        grib_output_buffer_puts(out, "\n      ");
+    }
+    grib_output_buffer_double(out, "%g", values[i]);
+    grib_output_buffer_flush(out);
+    grib_context_free(c, out);
+}
+
 static void dump_values(grib_dumper* d, grib_accessor* a)
 {
     grib_dumper_bufr_simple* self = (grib_dumper_bufr_simple*)d;
@@ -132,7 +157,7 @@ static void dump_values(grib_dumper* d, grib_accessor* a)
     size_t size = 0, size2 = 0;
     double* values                = NULL;
     int err                       = 0;
-    int i, r;
+    int r;
     int cols        = 9;
     long count      = 0;
     grib_context* c = a->context;
@@ -156,8 +181,6 @@ static void dump_values(grib_dumper* d, grib_accessor* a)
     self->empty = 0;
 
     if (size > 1) {
-        int icount = 0;
-
         if ((r = compute_bufr_key_rank(h, self->keys, a->name)) != 0)
             fprintf(self->dumper.out, "#%d#%s=", r, a->name);
         else
@@ -165,18 +188,7 @@ static void dump_values(grib_dumper* d, grib_accessor* a)
 
         fprintf(self->dumper.out, "{");
 
-        for (i = 0; i < size - 1; ++i) {
-            if (icount > cols || i == 0) {
-                fprintf(self->dumper.out, "\n      ");
-                icount = 0;
-            }
-            fprintf(self->dumper.out, "%g, ", values[i]);
-            icount++;
-        }
-        if (icount > cols || i == 0) {
-            fprintf(self->dumper.out, "\n      ");
-        }
-        fprintf(self->dumper.out, "%g", values[i]);
+        dump_double_array(self, values, size, cols);
 
         fprintf(self->dumper.out, "}\n");
         grib_context_free(c, values);
@@ -223,7 +235,6 @@ static void dump_values_attribute(grib_dumper* d, grib_accessor* a, const char*
     size_t size = 0, size2 = 0;
     double* values                = NULL;
     int err                       = 0;
-    int i, icount;
     int cols        = 9;
     long count      = 0;
     grib_context* c = a->context;
@@ -247,19 +258,7 @@ static void dump_values_attribute(grib_dumper* d, grib_accessor* a, const char*
 
     if (size > 1) {
         fprintf(self->dumper.out, "%s->%s = {", prefix, a->name);
-        icount = 0;
-        for (i = 0; i < size - 1; ++i) {
-            if (icount > cols || i == 0) {
-                fprintf(self->dumper.out, "\n      ");
-                icount = 0;
-            }
-            fprintf(self->dumper.out, "%g, ", values[i]);
-            icount++;
-        }
-        if (icount > cols || i == 0) {
-            fprintf(self->dumper.out, "\n      ");
-        }
-        fprintf(self->dumper.out, "%g", values[i]);
+        dump_double_array(self, values, size, cols);
 
         fprintf(self->dumper.out, "}\n");
         grib_context_free(c, values);
@@ -163,25 +163,33 @@ static void dump_values(grib_dumper* d, grib_accessor* a)
             fprintf(self->dumper.out, "%-*s", depth, " ");
             fprintf(self->dumper.out, "\"value\" :\n");
         }
-        fprintf(self->dumper.out, "%-*s[", depth, " ");
+        grib_output_buffer* out = (grib_output_buffer*)grib_context_malloc(a->context, sizeof(grib_output_buffer));
+        grib_output_buffer_init(out, self->dumper.out);
+        grib_output_buffer_indent(out, depth);
+        grib_output_buffer_write(out, "[", 1);
         depth += 2;
         for (i = 0; i < size - 1; ++i) {
             if (icount > cols || i == 0) {
-                fprintf(self->dumper.out, "\n%-*s", depth, " ");
+                grib_output_buffer_write(out, "\n", 1);
+                grib_output_buffer_indent(out, depth);
                 icount = 0;
             }
             if (values[i] == missing_value)
-                fprintf(self->dumper.out, "null, ");
+                grib_output_buffer_puts(out, "null, ");
             else
-                fprintf(self->dumper.out, "%g, ", values[i]);
+                grib_output_buffer_double(out, "%g, ", values[i]);
             icount++;
         }
-        if (icount > cols)
-            fprintf(self->dumper.out, "\n%-*s", depth, " ");
+        if (icount > cols) {
+            grib_output_buffer_write(out, "\n", 1);
+            grib_output_buffer_indent(out, depth);
+        }
         if (grib_is_missing_double(a, values[i]))
-            fprintf(self->dumper.out, "%s ", "null");
+            grib_output_buffer_puts(out, "null ");
         else
-            fprintf(self->dumper.out, "%g ", values[i]);
+            grib_output_buffer_double(out, "%g ", values[i]);
+        grib_output_buffer_flush(out);
+        grib_context_free(a->context, out);
 
         depth -= 2;
         fprintf(self->dumper.out, "\n%-*s]", depth, " ");
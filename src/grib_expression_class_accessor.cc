@@ -26,6 +26,8 @@
    MEMBERS    = char *name
    MEMBERS    = long start
    MEMBERS    = size_t length
+   MEMBERS    = int id
+   MEMBERS    = grib_itrie* keys
    END_CLASS_DEF
 
  */
@@ -56,6 +58,8 @@ typedef struct grib_expression_accessor{
     char *name;
     long start;
     size_t length;
+    int id;
+    grib_itrie* keys;
 } grib_expression_accessor;
 
 
@@ -85,16 +89,53 @@ static const char* get_name(grib_expression* g)
     return e->name;
 }
 
+/* The id of a plain key name is looked up once, when the expression is parsed,
+ * rather than each time the expression is evaluated */
+static grib_accessor* find_accessor(const grib_expression_accessor* e, grib_handle* h)
+{
+    if (e->id > 0 && e->keys == h->context->keys)
+        return grib_find_accessor_by_id(h, e->name, e->id);
+    return grib_find_accessor(h, e->name);
+}
+
 static int evaluate_long(grib_expression* g, grib_handle* h, long* result)
 {
     const grib_expression_accessor* e = (grib_expression_accessor*)g;
-    return grib_get_long_internal(h, e->name, result);
+    grib_accessor* a                  = NULL;
+    size_t length                     = 1;
+    int err                           = 0;
+
+    if (e->id <= 0)
+        return grib_get_long_internal(h, e->name, result);
+
+    if ((a = find_accessor(e, h)) == NULL)
+        err = GRIB_NOT_FOUND;
+    else
+        err = a->unpack_long(result, &length);
+    if (err != GRIB_SUCCESS)
+        grib_context_log(h->context, GRIB_LOG_ERROR,
+                         "Unable to get %s as long (%s)", e->name, grib_get_error_message(err));
+    return err;
 }
 
 static int evaluate_double(grib_expression* g, grib_handle* h, double* result)
 {
     const grib_expression_accessor* e = (grib_expression_accessor*)g;
-    return grib_get_double_internal(h, e->name, result);
+    grib_accessor* a                  = NULL;
+    size_t length                     = 1;
+    int err                           = 0;
+
+    if (e->id <= 0)
+        return grib_get_double_internal(h, e->name, result);
+
+    if ((a = find_accessor(e, h)) == NULL)
+        err = GRIB_NOT_FOUND;
+    else
+        err = a->unpack_double(result, &length);
+    if (err != GRIB_SUCCESS)
+        grib_context_log(h->context, GRIB_LOG_ERROR,
+                         "Unable to get %s as double (%s)", e->name, grib_get_error_message(err));
+    return err;
 }
 
 static string evaluate_string(grib_expression* g, grib_handle* h, char* buf, size_t* size, int* err)
@@ -108,7 +149,16 @@ static string evaluate_string(grib_expression* g, grib_handle* h, char* buf, siz
     }
 
     Assert(buf);
-    if ((*err = grib_get_string_internal(h, e->name, mybuf, size)) != GRIB_SUCCESS)
+    if (e->id > 0) {
+        grib_accessor* a = find_accessor(e, h);
+        *err             = a ? a->unpack_string(mybuf, size) : GRIB_NOT_FOUND;
+        if (*err != GRIB_SUCCESS) {
+            grib_context_log(h->context, GRIB_LOG_ERROR,
+                             "Unable to get %s as string (%s)", e->name, grib_get_error_message(*err));
+            return NULL;
+        }
+    }
+    else if ((*err = grib_get_string_internal(h, e->name, mybuf, size)) != GRIB_SUCCESS)
         return NULL;
 
     if (e->start < 0)
@@ -168,6 +218,11 @@ grib_expression* new_accessor_expression(grib_context* c, const char* name, long
     e->name                     = grib_context_strdup_persistent(c, name);
     e->start                    = start;
     e->length                   = length;
+    /* Only plain names: no namespace, rank, attribute or path */
+    if (c && c->keys && name[0] != '#' && name[0] != '/' && !strchr(name, '.') && !strstr(name, "->")) {
+        e->keys = c->keys;
+        e->id   = grib_hash_keys_get_id(c->keys, name);
+    }
     return (grib_expression*)e;
 }
 
@@ -176,7 +231,15 @@ static int native_type(grib_expression* g, grib_handle* h)
     grib_expression_accessor* e = (grib_expression_accessor*)g;
     int type = 0;
     int err;
-    if ((err = grib_get_native_type(h, e->name, &type)) != GRIB_SUCCESS) {
+    if (e->id > 0) {
+        grib_accessor* a = find_accessor(e, h);
+        if (a)
+            return a->get_native_type();
+        err = GRIB_NOT_FOUND;
+        grib_context_log(h->context, GRIB_LOG_ERROR,
+                         "Error in evaluating the type of '%s': %s", e->name, grib_get_error_message(err));
+    }
+    else if ((err = grib_get_native_type(h, e->name, &type)) != GRIB_SUCCESS) {
         grib_context_log(h->context, GRIB_LOG_ERROR,
                          "Error in evaluating the type of '%s': %s", e->name, grib_get_error_message(err));
     }
@@ -173,7 +173,20 @@ grib_expression* new_binop_expression(grib_context* c,
                                       grib_binop_double_proc double_func,
                                       grib_expression* left, grib_expression* right)
 {
-    grib_expression_binop* e = (grib_expression_binop*)grib_context_malloc_clear_persistent(c, sizeof(grib_expression_binop));
+    grib_expression_binop* e = NULL;
+    long v1 = 0, v2 = 0;
+
+    /* Constant folding, e.g. 24*3600. Only for integer literals and not for a division,
+     * which gives a different result when the expression is evaluated as a double */
+    if (long_func && long_func != &grib_op_div &&
+        grib_expression_is_long_constant(left, &v1) && grib_expression_is_long_constant(right, &v2) &&
+        !(v2 == 0 && long_func == &grib_op_modulo)) {
+        grib_expression_free(c, left);
+        grib_expression_free(c, right);
+        return new_long_expression(c, long_func(v1, v2));
+    }
+
+    e = (grib_expression_binop*)grib_context_malloc_clear_persistent(c, sizeof(grib_expression_binop));
     e->base.cclass           = grib_expression_class_binop;
     e->left                  = left;
     e->right                 = right;
@@ -159,7 +159,18 @@ static void add_dependency(grib_expression* g, grib_accessor* observer)
 
 grib_expression* new_logical_and_expression(grib_context* c, grib_expression* left, grib_expression* right)
 {
-    grib_expression_logical_and* e = (grib_expression_logical_and*)grib_context_malloc_clear_persistent(c, sizeof(grib_expression_logical_and));
+    grib_expression_logical_and* e = NULL;
+    long v1 = 0, v2 = 0;
+
+    /* Constant folding. The right operand is never evaluated when the left one is false */
+    if (grib_expression_is_long_constant(left, &v1) &&
+        (v1 == 0 || grib_expression_is_long_constant(right, &v2))) {
+        grib_expression_free(c, left);
+        grib_expression_free(c, right);
+        return new_long_expression(c, (v1 && v2) ? 1 : 0);
+    }
+
+    e = (grib_expression_logical_and*)grib_context_malloc_clear_persistent(c, sizeof(grib_expression_logical_and));
     e->base.cclass                 = grib_expression_class_logical_and;
     e->left                        = left;
     e->right                       = right;
@@ -101,6 +101,15 @@ static void add_dependency(grib_expression* g, grib_accessor* observer)
     /* grib_expression_long* e = (grib_expression_long*)g; */
 }
 
+/* Used for constant folding when parsing: returns 1 and the value if g is an integer literal */
+int grib_expression_is_long_constant(grib_expression* g, long* value)
+{
+    if (!g || g->cclass != grib_expression_class_long)
+        return 0;
+    *value = ((grib_expression_long*)g)->value;
+    return 1;
+}
+
 grib_expression* new_long_expression(grib_context* c, long value)
 {
     grib_expression_long* e = (grib_expression_long*)grib_context_malloc_clear_persistent(c, sizeof(grib_expression_long));
@@ -130,7 +130,16 @@ grib_expression* new_unop_expression(grib_context* c,
                                      grib_unop_double_proc double_func,
                                      grib_expression* exp)
 {
-    grib_expression_unop* e = (grib_expression_unop*)grib_context_malloc_clear_persistent(c, sizeof(grib_expression_unop));
+    grib_expression_unop* e = NULL;
+    long v = 0;
+
+    /* Constant folding, e.g. -1 */
+    if (long_func && grib_expression_is_long_constant(exp, &v)) {
+        grib_expression_free(c, exp);
+        return new_long_expression(c, long_func(v));
+    }
+
+    e = (grib_expression_unop*)grib_context_malloc_clear_persistent(c, sizeof(grib_expression_unop));
     e->base.cclass          = grib_expression_class_unop;
     e->exp                  = exp;
     e->long_func            = long_func;
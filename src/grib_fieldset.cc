@@ -25,6 +25,21 @@
 #define GRIB_ORDER_BY_ASC 1
 #define GRIB_ORDER_BY_DESC -1
 
+#define GRIB_WHERE_OP_COMPARE 1
+#define GRIB_WHERE_OP_AND 2
+#define GRIB_WHERE_OP_OR 3
+#define GRIB_WHERE_OP_NOT 4
+
+#define GRIB_WHERE_CMP_EQ 1
+#define GRIB_WHERE_CMP_NE 2
+#define GRIB_WHERE_CMP_LT 3
+#define GRIB_WHERE_CMP_LE 4
+#define GRIB_WHERE_CMP_GT 5
+#define GRIB_WHERE_CMP_GE 6
+
+/* Number of fields evaluated together by a where-clause program */
+#define GRIB_WHERE_BATCH_SIZE 256
+
 /* Note: A fast cut-down version of strcmp which does NOT return -1 */
 /* 0 means input strings are equal and 1 means not equal */
 GRIB_INLINE static int grib_inline_strcmp(const char* a, const char* b)
@@ -52,6 +67,7 @@ static grib_field** grib_fieldset_create_fields(grib_context* c, size_t size);
 static void grib_fieldset_delete_fields(grib_fieldset* set);
 static int grib_fieldset_resize_fields(grib_fieldset* set, size_t newsize);
 static int grib_fieldset_set_order_by(grib_fieldset* set, grib_order_by* ob);
+static void grib_where_delete(grib_where* w);
 
 
 /* --------------- grib_column functions ------------------*/
@@ -403,16 +419,411 @@ static grib_fieldset* grib_fieldset_create_from_order_by(grib_context* c, grib_o
     return set;
 }
 
-// Experimental: Needs more work
+/* --------------- grib_where functions ------------------*/
+/*
+ * A where-clause such as "(centre=='ecmf') && number==1 || step>=6" is compiled once
+ * into a postfix program whose comparisons refer to fieldset columns by index.
+ * The program is then run over the columns a batch of fields at a time, each
+ * instruction producing a selection mask for the whole batch, so no handle is
+ * created and no key is looked up by name while filtering.
+ */
+typedef struct grib_where_parser
+{
+    grib_fieldset* set;
+    grib_where* where;
+    const char* p;
+    int depth;
+    int err;
+} grib_where_parser;
+
+static void grib_where_skip_blanks(grib_where_parser* wp)
+{
+    while (isspace((unsigned char)*wp->p))
+        wp->p++;
+}
+
+static int grib_where_accept(grib_where_parser* wp, const char* token)
+{
+    size_t len = strlen(token);
+    grib_where_skip_blanks(wp);
+    if (strncmp(wp->p, token, len) == 0) {
+        wp->p += len;
+        return 1;
+    }
+    return 0;
+}
+
+static void grib_where_error(grib_where_parser* wp, const char* reason)
+{
+    if (wp->err == GRIB_SUCCESS) {
+        grib_context_log(wp->set->context, GRIB_LOG_ERROR,
+                         "grib_fieldset_apply_where: %s at \"%s\" in \"%s\"", reason, wp->p, wp->where->string);
+        wp->err = GRIB_INVALID_ARGUMENT;
+    }
+}
+
+static grib_where_op* grib_where_emit(grib_where_parser* wp, int code)
+{
+    grib_where* w = wp->where;
+    grib_where_op* op;
+
+    if (w->nops >= w->ops_size) {
+        size_t newsize         = w->ops_size ? 2 * w->ops_size : 16;
+        grib_where_op* newops = (grib_where_op*)grib_context_realloc(w->context, w->ops, newsize * sizeof(grib_where_op));
+        if (!newops) {
+            grib_context_log(w->context, GRIB_LOG_ERROR, "%s: Error allocating %zu bytes", __func__, newsize * sizeof(grib_where_op));
+            wp->err = GRIB_OUT_OF_MEMORY;
+            return NULL;
+        }
+        w->ops      = newops;
+        w->ops_size = newsize;
+    }
+    op = &w->ops[w->nops++];
+    memset(op, 0, sizeof(grib_where_op));
+    op->code = code;
+
+    /* Comparisons push a mask, logical operators pop two and push one */
+    if (code == GRIB_WHERE_OP_COMPARE)
+        wp->depth++;
+    else if (code != GRIB_WHERE_OP_NOT)
+        wp->depth--;
+    if (wp->depth > w->depth)
+        w->depth = wp->depth;
+
+    return op;
+}
+
+/* Operand: a fieldset column name or a literal (number or quoted string) */
+typedef struct grib_where_operand
+{
+    int idkey; /* -1 for literals */
+    int is_string;
+    char text[1024];
+} grib_where_operand;
+
+static int grib_where_read_operand(grib_where_parser* wp, grib_where_operand* o)
+{
+    size_t len = 0;
+    grib_where_skip_blanks(wp);
+    o->idkey     = -1;
+    o->is_string = 0;
+
+    if (*wp->p == '\'' || *wp->p == '"') {
+        char quote = *wp->p++;
+        while (*wp->p && *wp->p != quote && len < sizeof(o->text) - 1)
+            o->text[len++] = *wp->p++;
+        if (*wp->p != quote) {
+            grib_where_error(wp, "Unterminated string");
+            return 0;
+        }
+        wp->p++;
+        o->text[len] = 0;
+        o->is_string = 1;
+        return 1;
+    }
+
+    while ((isalnum((unsigned char)*wp->p) || *wp->p == '_' || *wp->p == '.' || *wp->p == '-' || *wp->p == '+') &&
+           len < sizeof(o->text) - 1) {
+        o->text[len++] = *wp->p++;
+    }
+    o->text[len] = 0;
+    if (len == 0) {
+        grib_where_error(wp, "Expected a key or a value");
+        return 0;
+    }
+
+    if (!isdigit((unsigned char)o->text[0]) && o->text[0] != '-' && o->text[0] != '+' && o->text[0] != '.') {
+        size_t i = 0;
+        for (i = 0; i < wp->set->columns_size; i++) {
+            if (!grib_inline_strcmp(o->text, wp->set->columns[i].name)) {
+                o->idkey = i;
+                return 1;
+            }
+        }
+        grib_context_log(wp->set->context, GRIB_LOG_ERROR,
+                         "grib_fieldset_apply_where: Key %s missing from the fieldset", o->text);
+        wp->err = GRIB_MISSING_KEY;
+        return 0;
+    }
+    return 1;
+}
+
+static int grib_where_read_comparator(grib_where_parser* wp)
+{
+    if (grib_where_accept(wp, "==")) return GRIB_WHERE_CMP_EQ;
+    if (grib_where_accept(wp, "!=")) return GRIB_WHERE_CMP_NE;
+    if (grib_where_accept(wp, "<=")) return GRIB_WHERE_CMP_LE;
+    if (grib_where_accept(wp, ">=")) return GRIB_WHERE_CMP_GE;
+    if (grib_where_accept(wp, "<")) return GRIB_WHERE_CMP_LT;
+    if (grib_where_accept(wp, ">")) return GRIB_WHERE_CMP_GT;
+    if (grib_where_accept(wp, "=")) return GRIB_WHERE_CMP_EQ;
+    grib_where_error(wp, "Expected a comparison operator");
+    return 0;
+}
+
+/* "value op key" is stored as "key op' value" */
+static int grib_where_swap_comparator(int cmp)
+{
+    switch (cmp) {
+        case GRIB_WHERE_CMP_LT: return GRIB_WHERE_CMP_GT;
+        case GRIB_WHERE_CMP_LE: return GRIB_WHERE_CMP_GE;
+        case GRIB_WHERE_CMP_GT: return GRIB_WHERE_CMP_LT;
+        case GRIB_WHERE_CMP_GE: return GRIB_WHERE_CMP_LE;
+        default: return cmp;
+    }
+}
+
+static void grib_where_parse_or(grib_where_parser* wp);
+
+static void grib_where_parse_comparison(grib_where_parser* wp)
+{
+    grib_where_operand lhs, rhs;
+    grib_where_operand *key, *value;
+    grib_column* column = NULL;
+    grib_where_op* op   = NULL;
+    char* end           = NULL;
+    int cmp             = 0;
+
+    if (!grib_where_read_operand(wp, &lhs)) return;
+    if (!(cmp = grib_where_read_comparator(wp))) return;
+    if (!grib_where_read_operand(wp, &rhs)) return;
+
+    if (lhs.idkey >= 0 && rhs.idkey < 0) {
+        key   = &lhs;
+        value = &rhs;
+    }
+    else if (lhs.idkey < 0 && rhs.idkey >= 0) {
+        key   = &rhs;
+        value = &lhs;
+        cmp   = grib_where_swap_comparator(cmp);
+    }
+    else {
+        grib_where_error(wp, "A comparison needs one key and one value");
+        return;
+    }
+
+    if (!(op = grib_where_emit(wp, GRIB_WHERE_OP_COMPARE))) return;
+    op->idkey = key->idkey;
+    op->cmp   = cmp;
+    column    = &wp->set->columns[key->idkey];
+
+    switch (column->type) {
+        case GRIB_TYPE_LONG:
+            op->lval = strtol(value->text, &end, 10);
+            if (value->is_string || *end != 0) {
+                grib_context_log(wp->set->context, GRIB_LOG_ERROR,
+                                 "grib_fieldset_apply_where: Key %s is an integer, cannot compare with '%s'", column->name, value->text);
+                wp->err = GRIB_INVALID_TYPE;
+            }
+            break;
+        case GRIB_TYPE_DOUBLE:
+            op->dval = strtod(value->text, &end);
+            if (value->is_string || *end != 0) {
+                grib_context_log(wp->set->context, GRIB_LOG_ERROR,
+                                 "grib_fieldset_apply_where: Key %s is a double, cannot compare with '%s'", column->name, value->text);
+                wp->err = GRIB_INVALID_TYPE;
+            }
+            break;
+        case GRIB_TYPE_STRING:
+            op->sval = grib_context_strdup(wp->set->context, value->text);
+            break;
+        default:
+            wp->err = GRIB_INVALID_TYPE;
+    }
+}
+
+static void grib_where_parse_primary(grib_where_parser* wp)
+{
+    if (grib_where_accept(wp, "(")) {
+        grib_where_parse_or(wp);
+        if (wp->err == GRIB_SUCCESS && !grib_where_accept(wp, ")"))
+            grib_where_error(wp, "Expected ')'");
+        return;
+    }
+    grib_where_parse_comparison(wp);
+}
+
+static void grib_where_parse_not(grib_where_parser* wp)
+{
+    grib_where_skip_blanks(wp);
+    if (wp->p[0] == '!' && wp->p[1] != '=') {
+        wp->p++;
+        grib_where_parse_not(wp);
+        if (wp->err == GRIB_SUCCESS)
+            grib_where_emit(wp, GRIB_WHERE_OP_NOT);
+        return;
+    }
+    grib_where_parse_primary(wp);
+}
+
+static void grib_where_parse_and(grib_where_parser* wp)
+{
+    grib_where_parse_not(wp);
+    while (wp->err == GRIB_SUCCESS && grib_where_accept(wp, "&&")) {
+        grib_where_parse_not(wp);
+        if (wp->err == GRIB_SUCCESS)
+            grib_where_emit(wp, GRIB_WHERE_OP_AND);
+    }
+}
+
+static void grib_where_parse_or(grib_where_parser* wp)
+{
+    grib_where_parse_and(wp);
+    while (wp->err == GRIB_SUCCESS && grib_where_accept(wp, "||")) {
+        grib_where_parse_and(wp);
+        if (wp->err == GRIB_SUCCESS)
+            grib_where_emit(wp, GRIB_WHERE_OP_OR);
+    }
+}
+
+static void grib_where_delete(grib_where* w)
+{
+    size_t i = 0;
+    if (!w)
+        return;
+    for (i = 0; i < w->nops; i++)
+        grib_context_free(w->context, w->ops[i].sval);
+    grib_context_free(w->context, w->ops);
+    grib_context_free(w->context, w->string);
+    grib_context_free(w->context, w);
+}
+
+static grib_where* grib_where_compile(grib_fieldset* set, const char* where_string, int* err)
+{
+    grib_where_parser wp = {0,};
+    grib_where* w        = (grib_where*)grib_context_malloc_clear(set->context, sizeof(grib_where));
+    if (!w) {
+        *err = GRIB_OUT_OF_MEMORY;
+        return NULL;
+    }
+    w->context = set->context;
+    w->string  = grib_context_strdup(set->context, where_string);
+
+    wp.set   = set;
+    wp.where = w;
+    wp.p     = where_string;
+    wp.err   = GRIB_SUCCESS;
+
+    grib_where_parse_or(&wp);
+    grib_where_skip_blanks(&wp);
+    if (wp.err == GRIB_SUCCESS && *wp.p != 0)
+        grib_where_error(&wp, "Unexpected characters");
+
+    *err = wp.err;
+    if (*err != GRIB_SUCCESS) {
+        grib_where_delete(w);
+        return NULL;
+    }
+    return w;
+}
+
+#define GRIB_WHERE_COMPARE_LOOP(values, ref)                                          \
+    switch (op->cmp) {                                                                \
+        case GRIB_WHERE_CMP_EQ: for (k = 0; k < n; k++) m[k] = (values) == (ref); break; \
+        case GRIB_WHERE_CMP_NE: for (k = 0; k < n; k++) m[k] = (values) != (ref); break; \
+        case GRIB_WHERE_CMP_LT: for (k = 0; k < n; k++) m[k] = (values) < (ref); break;  \
+        case GRIB_WHERE_CMP_LE: for (k = 0; k < n; k++) m[k] = (values) <= (ref); break; \
+        case GRIB_WHERE_CMP_GT: for (k = 0; k < n; k++) m[k] = (values) > (ref); break;  \
+        case GRIB_WHERE_CMP_GE: for (k = 0; k < n; k++) m[k] = (values) >= (ref); break; \
+    }
+
+/* Evaluate the compiled program for the n fields whose indexes are in idx. Result goes in stack[0] */
+static void grib_where_evaluate_batch(const grib_fieldset* set, const grib_where* w,
+                                      const int* idx, size_t n, unsigned char* stack)
+{
+    size_t i = 0, k = 0;
+    size_t sp = 0; /* Number of masks on the stack */
+
+    for (i = 0; i < w->nops; i++) {
+        const grib_where_op* op = &w->ops[i];
+        unsigned char* m        = NULL;
+        unsigned char* top      = NULL;
+        switch (op->code) {
+            case GRIB_WHERE_OP_COMPARE: {
+                const grib_column* column = &set->columns[op->idkey];
+                m = stack + GRIB_WHERE_BATCH_SIZE * sp++;
+                switch (column->type) {
+                    case GRIB_TYPE_LONG:
+                        GRIB_WHERE_COMPARE_LOOP(column->long_values[idx[k]], op->lval)
+                        break;
+                    case GRIB_TYPE_DOUBLE:
+                        GRIB_WHERE_COMPARE_LOOP(column->double_values[idx[k]], op->dval)
+                        break;
+                    case GRIB_TYPE_STRING:
+                        GRIB_WHERE_COMPARE_LOOP(strcmp(column->string_values[idx[k]], op->sval), 0)
+                        break;
+                }
+                /* A key that could not be read never matches */
+                for (k = 0; k < n; k++)
+                    m[k] &= (column->errors[idx[k]] == GRIB_SUCCESS);
+                break;
+            }
+            case GRIB_WHERE_OP_NOT:
+                m = stack + GRIB_WHERE_BATCH_SIZE * (sp - 1);
+                for (k = 0; k < n; k++)
+                    m[k] = !m[k];
+                break;
+            case GRIB_WHERE_OP_AND:
+                top = stack + GRIB_WHERE_BATCH_SIZE * --sp;
+                m   = top - GRIB_WHERE_BATCH_SIZE;
+                for (k = 0; k < n; k++)
+                    m[k] &= top[k];
+                break;
+            case GRIB_WHERE_OP_OR:
+                top = stack + GRIB_WHERE_BATCH_SIZE * --sp;
+                m   = top - GRIB_WHERE_BATCH_SIZE;
+                for (k = 0; k < n; k++)
+                    m[k] |= top[k];
+                break;
+        }
+    }
+}
+
 int grib_fieldset_apply_where(grib_fieldset* set, const char* where_string)
 {
-    // grib_math* m = NULL;
-    // m = grib_math_new(set->context, where_string, &err);
-    // if (err || !m) return err;
-    // print_math(m);
-    // printf("\n");
-    // grib_math_delete(set->context, m);
-    return GRIB_NOT_IMPLEMENTED;
+    int err              = GRIB_SUCCESS;
+    grib_where* w        = NULL;
+    unsigned char* stack = NULL;
+    size_t i = 0, k = 0, n = 0, count = 0;
+
+    if (!set || !where_string)
+        return GRIB_INVALID_ARGUMENT;
+
+    w = grib_where_compile(set, where_string, &err);
+    if (err != GRIB_SUCCESS)
+        return err;
+
+    stack = (unsigned char*)grib_context_malloc(set->context, w->depth * GRIB_WHERE_BATCH_SIZE);
+    if (!stack) {
+        grib_where_delete(w);
+        return GRIB_OUT_OF_MEMORY;
+    }
+
+    /* Only the fields selected so far are candidates. Compaction is in place */
+    for (i = 0; i < set->size; i += n) {
+        n = set->size - i;
+        if (n > GRIB_WHERE_BATCH_SIZE)
+            n = GRIB_WHERE_BATCH_SIZE;
+        grib_where_evaluate_batch(set, w, set->filter->el + i, n, stack);
+        for (k = 0; k < n; k++) {
+            if (stack[k])
+                set->filter->el[count++] = set->filter->el[i + k];
+        }
+    }
+    grib_context_free(set->context, stack);
+
+    set->size = count;
+    for (i = 0; i < count; i++)
+        set->order->el[i] = i;
+
+    grib_where_delete(set->where);
+    set->where = w;
+
+    if (set->order_by)
+        grib_fieldset_sort(set, 0, set->size - 1);
+    grib_fieldset_rewind(set);
+
+    return GRIB_SUCCESS;
 }
 
 int grib_fieldset_apply_order_by(grib_fieldset* set, const char* order_by_string)
@@ -629,6 +1040,7 @@ void grib_fieldset_delete(grib_fieldset* set)
     grib_fieldset_delete_int_array(set->order);
     grib_fieldset_delete_int_array(set->filter);
     grib_fieldset_delete_order_by(c, set->order_by);
+    grib_where_delete(set->where);
 
     grib_context_free(c, set);
 }
@@ -638,6 +1050,7 @@ int grib_fieldset_add(grib_fieldset* set, const char* filename)
     int ret        = GRIB_SUCCESS;
     int err        = 0;
     int i          = 0;
+    size_t ifield  = 0;
     grib_handle* h = NULL;
     /* int nkeys; */
     grib_file* file;
@@ -657,7 +1070,7 @@ int grib_fieldset_add(grib_fieldset* set, const char* filename)
 
     while ((h = grib_handle_new_from_file(c, file->handle, &ret)) != NULL || ret != GRIB_SUCCESS) {
         if (!h)
-            return ret;
+            break;
 
         err = GRIB_SUCCESS;
         for (i = 0; i < set->columns_size; i++) {
@@ -669,19 +1082,21 @@ int grib_fieldset_add(grib_fieldset* set, const char* filename)
             if (set->fields_array_size < set->columns[0].values_array_size) {
                 ret = grib_fieldset_resize(set, set->columns[0].values_array_size);
                 if (ret != GRIB_SUCCESS)
-                    return ret;
+                    break;
             }
+            /* Fields are stored at their column index; set->size counts the selected ones */
+            ifield                       = set->columns[0].size - 1;
             offset                       = 0;
             grib_get_double(h, "offset", &offset);
-            set->fields[set->size]       = (grib_field*)grib_context_malloc_clear(c, sizeof(grib_field));
-            set->fields[set->size]->file = file;
+            set->fields[ifield]          = (grib_field*)grib_context_malloc_clear(c, sizeof(grib_field));
+            set->fields[ifield]->file    = file;
             file->refcount++;
-            set->fields[set->size]->offset = (off_t)offset;
+            set->fields[ifield]->offset  = (off_t)offset;
             grib_get_long(h, "totalLength", &length);
-            set->fields[set->size]->length = length;
-            set->filter->el[set->size]     = set->size;
-            set->order->el[set->size]      = set->size;
-            set->size                      = set->columns[0].size;
+            set->fields[ifield]->length  = length;
+            set->filter->el[set->size]   = ifield;
+            set->order->el[set->size]    = set->size;
+            set->size++;
         }
         grib_handle_delete(h);
     }
@@ -753,10 +1168,16 @@ grib_handle* grib_fieldset_retrieve(grib_fieldset* set, int i, int* err)
     if (*err != GRIB_SUCCESS)
         return NULL;
 
-    fseeko(field->file->handle, field->offset, SEEK_SET);
-    h = grib_handle_new_from_file(set->context, field->file->handle, err);
-    if (*err != GRIB_SUCCESS)
+    h = grib_file_handle_new(set->context, field->file, field->offset, field->length, err);
+    if (*err == GRIB_NOT_IMPLEMENTED) {
+        fseeko(field->file->handle, field->offset, SEEK_SET);
+        h = grib_handle_new_from_file(set->context, field->file->handle, err);
+    }
+    if (*err != GRIB_SUCCESS) {
+        int cerr = 0;
+        grib_file_close(field->file->name, 0, &cerr); /* Pairs with the open above */
         return NULL;
+    }
 
     grib_file_close(field->file->name, 0, err);
 
@@ -865,8 +1286,9 @@ static int grib_fieldset_resize_fields(grib_fieldset* set, size_t newsize)
 
 static void grib_fieldset_delete_fields(grib_fieldset* set)
 {
-    int i;
-    for (i = 0; i < set->size; i++) {
+    size_t i;
+    /* A where-clause may have reduced set->size below the number of fields loaded */
+    for (i = 0; i < set->fields_array_size; i++) {
         if (!set->fields[i])
             continue;
         set->fields[i]->file->refcount--;
@@ -11,6 +11,9 @@
 #include "grib_api_internal.h"
 #define GRIB_MAX_OPENED_FILES 200
 
+/* Initial number of buckets of the pool hash table (a power of 2) */
+#define GRIB_FILE_POOL_BUCKETS 64
+
 #if GRIB_PTHREADS
 static pthread_once_t once    = PTHREAD_ONCE_INIT;
 static pthread_mutex_t mutex1 = PTHREAD_MUTEX_INITIALIZER;
@@ -57,14 +60,142 @@ GRIB_INLINE static int grib_inline_strcmp(const char* a, const char* b)
 }
 
 static grib_file_pool file_pool = {
-    0,                    /* grib_context* context;*/
-    0,                    /* grib_file* first;*/
-    0,                    /* grib_file* current; */
-    0,                    /* size_t size;*/
-    0,                    /* int number_of_opened_files;*/
-    GRIB_MAX_OPENED_FILES /* int max_opened_files; */
+    0,                     /* grib_context* context;*/
+    0,                     /* grib_file* first;*/
+    0,                     /* grib_file* current; */
+    0,                     /* size_t size;*/
+    0,                     /* int number_of_opened_files;*/
+    GRIB_MAX_OPENED_FILES, /* int max_opened_files; */
+    0,                     /* grib_file** buckets; */
+    0,                     /* size_t nbuckets; */
+    0,                     /* grib_file* lru_first; */
+    0                      /* grib_file* lru_last; */
 };
 
+/*
+ * Files are found by name through a hash table and the open ones are kept
+ * in a least-recently-used list. The pool mutex is only held for these O(1)
+ * updates, never for a scan of the whole pool or for reading a message.
+ */
+
+static unsigned long grib_file_hash(const char* name)
+{
+    /* FNV-1a */
+    unsigned long h = 2166136261UL;
+    while (*name) {
+        h ^= (unsigned char)*name++;
+        h *= 16777619UL;
+    }
+    return h;
+}
+
+/* Must be called with mutex1 held */
+static grib_file* grib_file_pool_find(const char* filename, unsigned long hash)
+{
+    grib_file* file = NULL;
+    if (!file_pool.buckets)
+        return NULL;
+    file = file_pool.buckets[hash & (file_pool.nbuckets - 1)];
+    while (file) {
+        if (file->hash == hash && !grib_inline_strcmp(filename, file->name))
+            return file;
+        file = file->hash_next;
+    }
+    return NULL;
+}
+
+/* Must be called with mutex1 held */
+static int grib_file_pool_insert(grib_file* file)
+{
+    size_t i = 0, b = 0;
+    if (file_pool.size >= file_pool.nbuckets) {
+        size_t nbuckets      = file_pool.nbuckets ? 2 * file_pool.nbuckets : GRIB_FILE_POOL_BUCKETS;
+        grib_file** buckets = (grib_file**)calloc(nbuckets, sizeof(grib_file*));
+        if (!buckets)
+            return GRIB_OUT_OF_MEMORY;
+        for (i = 0; i < file_pool.nbuckets; i++) {
+            grib_file* f = file_pool.buckets[i];
+            while (f) {
+                grib_file* next = f->hash_next;
+                b               = f->hash & (nbuckets - 1);
+                f->hash_next    = buckets[b];
+                buckets[b]      = f;
+                f               = next;
+            }
+        }
+        free(file_pool.buckets);
+        file_pool.buckets  = buckets;
+        file_pool.nbuckets = nbuckets;
+    }
+    b                    = file->hash & (file_pool.nbuckets - 1);
+    file->hash_next      = file_pool.buckets[b];
+    file_pool.buckets[b] = file;
+    return GRIB_SUCCESS;
+}
+
+/* Must be called with mutex1 held */
+static void grib_file_pool_remove(grib_file* file)
+{
+    grib_file** pf = NULL;
+    if (!file_pool.buckets)
+        return;
+    pf = &file_pool.buckets[file->hash & (file_pool.nbuckets - 1)];
+    while (*pf) {
+        if (*pf == file) {
+            *pf = file->hash_next;
+            break;
+        }
+        pf = &(*pf)->hash_next;
+    }
+    file->hash_next = NULL;
+}
+
+/* Must be called with mutex1 held */
+static void grib_file_lru_unlink(grib_file* file)
+{
+    if (file->lru_prev)
+        file->lru_prev->lru_next = file->lru_next;
+    else if (file_pool.lru_first == file)
+        file_pool.lru_first = file->lru_next;
+    if (file->lru_next)
+        file->lru_next->lru_prev = file->lru_prev;
+    else if (file_pool.lru_last == file)
+        file_pool.lru_last = file->lru_prev;
+    file->lru_prev = file->lru_next = NULL;
+}
+
+/* Must be called with mutex1 held. Marks an open file as the most recently used */
+static void grib_file_lru_touch(grib_file* file)
+{
+    if (file_pool.lru_first == file)
+        return;
+    grib_file_lru_unlink(file);
+    file->lru_next = file_pool.lru_first;
+    if (file_pool.lru_first)
+        file_pool.lru_first->lru_prev = file;
+    file_pool.lru_first = file;
+    if (!file_pool.lru_last)
+        file_pool.lru_last = file;
+}
+
+/* Must be called with mutex1 held */
+static int grib_file_fclose(grib_file* file)
+{
+    int err = GRIB_SUCCESS;
+    if (!file->handle)
+        return err;
+    if (fclose(file->handle) != 0)
+        err = GRIB_IO_PROBLEM;
+    if (file->buffer) {
+        free(file->buffer);
+        file->buffer = 0;
+    }
+    file->handle = NULL;
+    grib_file_lru_unlink(file);
+    file_pool.number_of_opened_files--;
+    return err;
+}
+
 void grib_file_pool_clean()
 {
     grib_file *file, *next;
@@ -72,12 +203,24 @@ void grib_file_pool_clean()
     if (!file_pool.first)
         return;
 
+    GRIB_MUTEX_INIT_ONCE(&once, &init);
+    GRIB_MUTEX_LOCK(&mutex1);
     file = file_pool.first;
     while (file) {
         next = file->next;
         grib_file_delete(file);
         file = next;
     }
+    free(file_pool.buckets);
+    file_pool.first                  = NULL;
+    file_pool.current                = NULL;
+    file_pool.size                   = 0;
+    file_pool.number_of_opened_files = 0;
+    file_pool.buckets                = NULL;
+    file_pool.nbuckets               = 0;
+    file_pool.lru_first              = NULL;
+    file_pool.lru_last               = NULL;
+    GRIB_MUTEX_UNLOCK(&mutex1);
 }
 
 // static void grib_file_pool_change_id()
@@ -172,49 +315,51 @@ void grib_file_pool_clean()
 
 grib_file* grib_file_open(const char* filename, const char* mode, int* err)
 {
-    grib_file *file = 0, *prev = 0;
-    int same_mode = 0;
-    int is_new    = 0;
+    grib_file* file    = 0;
+    int same_mode      = 0;
+    int is_new         = 0;
+    unsigned long hash = 0;
     GRIB_MUTEX_INIT_ONCE(&once, &init);
 
     if (!file_pool.context)
         file_pool.context = grib_context_get_default();
 
-    if (file_pool.current && !grib_inline_strcmp(filename, file_pool.current->name)) {
+    hash = grib_file_hash(filename);
+
+    GRIB_MUTEX_LOCK(&mutex1);
+    if (file_pool.current && file_pool.current->hash == hash && !grib_inline_strcmp(filename, file_pool.current->name)) {
         file = file_pool.current;
     }
     else {
-        GRIB_MUTEX_LOCK(&mutex1);
-        file = file_pool.first;
-        while (file) {
-            if (!grib_inline_strcmp(filename, file->name))
-                break;
-            prev = file;
-            file = file->next;
-        }
+        file = grib_file_pool_find(filename, hash);
         if (!file) {
             is_new = 1;
             file   = grib_file_new(file_pool.context, filename, err);
-            if (prev)
-                prev->next = file;
-            file_pool.current = file;
-            if (!prev)
-                file_pool.first = file;
+            if (!file || grib_file_pool_insert(file) != GRIB_SUCCESS) {
+                grib_file_delete(file);
+                *err = GRIB_OUT_OF_MEMORY;
+                GRIB_MUTEX_UNLOCK(&mutex1);
+                return NULL;
+            }
+            file->next      = file_pool.first;
+            file_pool.first = file;
             file_pool.size++;
         }
-        GRIB_MUTEX_UNLOCK(&mutex1);
+        file_pool.current = file;
     }
 
     if (file->mode)
         same_mode = grib_inline_strcmp(mode, file->mode) ? 0 : 1;
     if (file->handle && same_mode) {
+        grib_file_lru_touch(file);
+        file->users++;
+        GRIB_MUTEX_UNLOCK(&mutex1);
         *err = 0;
         return file;
     }
 
-    GRIB_MUTEX_LOCK(&mutex1);
     if (!same_mode && file->handle) {
-        fclose(file->handle);
+        grib_file_fclose(file);
     }
 
     if (!file->handle) {
@@ -249,6 +394,8 @@ grib_file* grib_file_open(const char* filename, const char* mode, int* err)
 
         file_pool.number_of_opened_files++;
     }
+    grib_file_lru_touch(file);
+    file->users++;
 
     GRIB_MUTEX_UNLOCK(&mutex1);
     return file;
@@ -278,7 +425,10 @@ void grib_file_pool_delete_file(grib_file* file)
         }
     }
 
+    grib_file_pool_remove(file);
+    file_pool.size--;
     if (file->handle) {
+        grib_file_lru_unlink(file);
         file_pool.number_of_opened_files--;
     }
     grib_file_delete(file);
@@ -288,33 +438,138 @@ void grib_file_pool_delete_file(grib_file* file)
 void grib_file_close(const char* filename, int force, int* err)
 {
     grib_file* file       = NULL;
+    grib_file* victim     = NULL;
     grib_context* context = grib_context_get_default();
+    int do_close          = 0;
+
+    GRIB_MUTEX_INIT_ONCE(&once, &init);
+    GRIB_MUTEX_LOCK(&mutex1);
+
+    /* Every grib_file_open is paired with exactly one grib_file_close */
+    file = grib_file_pool_find(filename, grib_file_hash(filename));
+    if (file) {
+        DEBUG_ASSERT(file->users > 0);
+        file->users--;
+    }
 
     /* Performance: keep the files open to avoid opening and closing files when writing the output. */
     /* So only call fclose() when too many files are open. */
     /* Also see ECC-411 */
-    int do_close = (file_pool.number_of_opened_files > context->file_pool_max_opened_files);
+    do_close = (file_pool.number_of_opened_files > context->file_pool_max_opened_files);
     if (force == 1)
         do_close = 1; /* Can be overridden with the force argument */
 
     if (do_close) {
         /*printf("+++++++++++++ closing file %s (n=%d)\n",filename, file_pool.number_of_opened_files);*/
-        GRIB_MUTEX_INIT_ONCE(&once, &init);
-        GRIB_MUTEX_LOCK(&mutex1);
-        file = grib_get_file(filename, err);
-        if (file->handle) {
-            if (fclose(file->handle) != 0) {
+        if (force == 1) {
+            file = grib_get_file(filename, err);
+            if (file && file->handle && grib_file_fclose(file) != GRIB_SUCCESS)
                 *err = GRIB_IO_PROBLEM;
+        }
+        else {
+            /* Too many open files: close the least recently used ones rather than the one
+             * just used, which is the most likely to be opened again next. Files another
+             * caller still has open (between its grib_file_open and grib_file_close) or
+             * is reading from are skipped */
+            victim = file_pool.lru_last;
+            while (victim && file_pool.number_of_opened_files > context->file_pool_max_opened_files) {
+                grib_file* prev = victim->lru_prev;
+                if (victim->readers == 0 && victim->users == 0 && grib_file_fclose(victim) != GRIB_SUCCESS)
+                    *err = GRIB_IO_PROBLEM;
+                victim = prev;
             }
-            if (file->buffer) {
-                free(file->buffer);
-                file->buffer = 0;
-            }
-            file->handle = NULL;
-            file_pool.number_of_opened_files--;
         }
+    }
+    GRIB_MUTEX_UNLOCK(&mutex1);
+}
+
+/* Read a message of known length at the given offset with pread, so that concurrent
+ * readers of the same file neither serialise on nor disturb the FILE* position.
+ * The file must have been opened for reading with grib_file_open. */
+void* grib_file_read_message(grib_context* c, grib_file* file, off_t offset, size_t length, int* err)
+{
+    unsigned char* data = NULL;
+    size_t done         = 0;
+
+    if (!c)
+        c = grib_context_get_default();
+    *err = GRIB_SUCCESS;
+    if (!file || !file->handle || length == 0) {
+        *err = GRIB_INVALID_ARGUMENT;
+        return NULL;
+    }
+
+    data = (unsigned char*)grib_context_malloc(c, length);
+    if (!data) {
+        *err = GRIB_OUT_OF_MEMORY;
+        return NULL;
+    }
+
+    GRIB_MUTEX_INIT_ONCE(&once, &init);
+    GRIB_MUTEX_LOCK(&mutex1);
+    file->readers++;
+#ifdef ECCODES_ON_WINDOWS
+    if (fseeko(file->handle, offset, SEEK_SET) == 0)
+        done = fread(data, 1, length, file->handle);
+    GRIB_MUTEX_UNLOCK(&mutex1);
+#else
+    {
+        int fd = fileno(file->handle);
         GRIB_MUTEX_UNLOCK(&mutex1);
+        while (done < length) {
+            ssize_t n = pread(fd, data + done, length - done, offset + done);
+            if (n <= 0)
+                break;
+            done += n;
+        }
     }
+#endif
+    GRIB_MUTEX_LOCK(&mutex1);
+    file->readers--;
+    GRIB_MUTEX_UNLOCK(&mutex1);
+
+    if (done != length) {
+        grib_context_log(c, GRIB_LOG_ERROR, "%s: Unable to read %zu bytes at offset %ld from '%s'",
+                         __func__, length, (long)offset, file->name);
+        grib_context_free(c, data);
+        *err = GRIB_IO_PROBLEM;
+        return NULL;
+    }
+    return data;
+}
+
+/* Create a handle from a message of known offset and length in an open pool file.
+ * Returns NULL with err=GRIB_NOT_IMPLEMENTED when the context needs the sequential
+ * reader instead (multi-field messages or GTS headers) */
+grib_handle* grib_file_handle_new(grib_context* c, grib_file* file, off_t offset, size_t length, int* err)
+{
+    grib_handle* h = NULL;
+    void* data     = NULL;
+
+    if (!c)
+        c = grib_context_get_default();
+    if (length == 0 || c->multi_support_on || c->gts_header_on) {
+        *err = GRIB_NOT_IMPLEMENTED;
+        return NULL;
+    }
+
+    data = grib_file_read_message(c, file, offset, length, err);
+    if (!data)
+        return NULL;
+
+    h = grib_handle_new_from_message(c, data, length);
+    if (!h) {
+        grib_context_log(c, GRIB_LOG_ERROR, "%s: Cannot create handle", __func__);
+        grib_context_free(c, data);
+        *err = GRIB_DECODING_ERROR;
+        return NULL;
+    }
+    h->offset           = offset;
+    h->buffer->property = CODES_MY_BUFFER;
+    grib_context_increment_handle_file_count(c);
+    grib_context_increment_handle_total_count(c);
+
+    return h;
 }
 
 void grib_file_close_all(int* err)
@@ -328,11 +583,8 @@ void grib_file_close_all(int* err)
 
     file = file_pool.first;
     while (file) {
-        if (file->handle) {
-            if (fclose(file->handle) != 0) {
-                *err = GRIB_IO_PROBLEM;
-            }
-            file->handle = NULL;
+        if (file->handle && grib_file_fclose(file) != GRIB_SUCCESS) {
+            *err = GRIB_IO_PROBLEM;
         }
         file = file->next;
     }
@@ -353,12 +605,10 @@ grib_file* grib_get_file(const char* filename, int* err)
         return file_pool.current;
     }
 
-    file = file_pool.first;
-    while (file) {
-        if (!grib_inline_strcmp(filename, file->name))
-            break;
-        file = file->next;
-    }
+    GRIB_MUTEX_INIT_ONCE(&once, &init);
+    GRIB_MUTEX_LOCK(&mutex1);
+    file = grib_file_pool_find(filename, grib_file_hash(filename));
+    GRIB_MUTEX_UNLOCK(&mutex1);
     if (!file)
         file = grib_file_new(0, filename, err);
 
@@ -393,6 +643,7 @@ static grib_file* grib_file_new(grib_context* c, const char* name, int* err)
     GRIB_MUTEX_INIT_ONCE(&once, &init);
 
     file->name = strdup(name);
+    file->hash = grib_file_hash(name);
     file->id   = next_id;
 
     GRIB_MUTEX_LOCK(&mutex1);
@@ -435,3 +686,113 @@ void grib_file_delete(grib_file* file)
     /* file = NULL; */
     GRIB_MUTEX_UNLOCK(&mutex1);
 }
+
+/* While a thread captures, the write and print rules append their output
+ * here instead of writing it. Tools processing messages on several threads
+ * replay it with grib_output_capture_flush, in message order */
+static thread_local grib_output_capture* current_capture = NULL;
+
+void grib_output_capture_start(grib_output_capture* oc)
+{
+    current_capture = oc;
+}
+
+void grib_output_capture_stop(void)
+{
+    current_capture = NULL;
+}
+
+grib_output_capture* grib_output_capture_current(void)
+{
+    return current_capture;
+}
+
+int grib_output_capture_add(grib_output_capture* oc, const char* filename, const char* mode, int pooled,
+                            const void* data, size_t length)
+{
+    grib_output_record* r = oc->last;
+    grib_context* c       = oc->context ? oc->context : grib_context_get_default();
+    unsigned char* buf    = NULL;
+
+    /* Consecutive pieces for the same file (GTS header, message, padding) are merged */
+    if (!r || r->pooled != pooled || strcmp(r->mode, mode) != 0 ||
+        (r->filename == NULL) != (filename == NULL) || (filename && strcmp(r->filename, filename) != 0)) {
+        r = (grib_output_record*)grib_context_malloc_clear(c, sizeof(grib_output_record));
+        if (!r)
+            return GRIB_OUT_OF_MEMORY;
+        r->filename = filename ? grib_context_strdup(c, filename) : NULL;
+        strncpy(r->mode, mode, sizeof(r->mode) - 1);
+        r->pooled = pooled;
+        if (oc->last)
+            oc->last->next = r;
+        else
+            oc->first = r;
+        oc->last = r;
+    }
+    if (length == 0)
+        return GRIB_SUCCESS;
+
+    buf = (unsigned char*)grib_context_realloc(c, r->data, r->length + length);
+    if (!buf)
+        return GRIB_OUT_OF_MEMORY;
+    memcpy(buf + r->length, data, length);
+    r->data = buf;
+    r->length += length;
+    return GRIB_SUCCESS;
+}
+
+/* Discard the captured output */
+void grib_output_capture_clear(grib_output_capture* oc)
+{
+    grib_context* c       = oc->context ? oc->context : grib_context_get_default();
+    grib_output_record* r = oc->first;
+    while (r) {
+        grib_output_record* next = r->next;
+        grib_context_free(c, r->filename);
+        grib_context_free(c, r->data);
+        grib_context_free(c, r);
+        r = next;
+    }
+    oc->first = oc->last = NULL;
+}
+
+/* Write the captured output, in the order it was produced, and discard it */
+int grib_output_capture_flush(grib_output_capture* oc)
+{
+    grib_context* c       = oc->context ? oc->context : grib_context_get_default();
+    grib_output_record* r = NULL;
+    int err               = GRIB_SUCCESS;
+
+    for (r = oc->first; r && err == GRIB_SUCCESS; r = r->next) {
+        if (r->pooled) {
+            grib_file* of = grib_file_open(r->filename, r->mode, &err);
+            if (!of || !of->handle) {
+                grib_context_log(c, GRIB_LOG_ERROR, "Unable to open file '%s'", r->filename);
+                err = GRIB_IO_PROBLEM;
+                break;
+            }
+            if (fwrite(r->data, 1, r->length, of->handle) != r->length) {
+                grib_context_log(c, (GRIB_LOG_ERROR) | (GRIB_LOG_PERROR), "Error writing to '%s'", r->filename);
+                err = GRIB_IO_PROBLEM;
+            }
+            grib_file_close(r->filename, 0, &err);
+        }
+        else {
+            FILE* out = r->filename ? fopen(r->filename, r->mode) : stdout;
+            if (!out) {
+                grib_context_log(c, (GRIB_LOG_ERROR) | (GRIB_LOG_PERROR), "Unable to open file '%s'", r->filename);
+                err = GRIB_IO_PROBLEM;
+                break;
+            }
+            if (fwrite(r->data, 1, r->length, out) != r->length) {
+                grib_context_log(c, (GRIB_LOG_ERROR) | (GRIB_LOG_PERROR), "Error writing to '%s'",
+                                 r->filename ? r->filename : "stdout");
+                err = GRIB_IO_PROBLEM;
+            }
+            if (r->filename)
+                fclose(out);
+        }
+    }
+    grib_output_capture_clear(oc);
+    return err;
+}
@@ -18,6 +18,7 @@ static grib_handle* grib_handle_new_from_file_multi(grib_context* c, FILE* f, in
 static bool grib2_get_next_section(unsigned char* msgbegin, size_t msglen, unsigned char** secbegin, size_t* seclen, int* secnum, int* err);
 static bool grib2_has_next_section(unsigned char* msgbegin, size_t msglen, unsigned char* secbegin, size_t seclen, int* err);
 static void grib2_build_message(grib_context* context, unsigned char* sections[], size_t sections_len[], void** data, size_t* msglen);
+static bool grib2_sections_in_place(const unsigned char* message, size_t msglen, unsigned char* sections[], const size_t sections_len[]);
 static grib_multi_support* grib_get_multi_support(grib_context* c, FILE* f);
 static grib_multi_support* grib_multi_support_new(grib_context* c);
 static grib_handle* grib_handle_new_multi(grib_context* c, unsigned char** idata, size_t* buflen, int* error);
@@ -35,13 +36,25 @@ static GRIB_INLINE int grib_inline_strcmp(const char* a, const char* b)
     return (*a == 0 && *b == 0) ? 0 : 1;
 }
 
+/* The arena of the handle being reparsed also serves its temporary kid:
+ * the accessors built there are swapped into the main handle */
+grib_arena* grib_handle_arena(grib_handle* h)
+{
+    while (h->main)
+        h = h->main;
+    if (!h->arena)
+        h->arena = grib_arena_new(h->context);
+    return h->arena;
+}
+
 grib_section* grib_section_create(grib_handle* h, grib_accessor* owner)
 {
-    grib_section* s = (grib_section*)grib_context_malloc_clear(h->context, sizeof(grib_section));
-    s->owner        = owner;
-    s->aclength     = NULL;
-    s->h            = h;
-    s->block        = (grib_block_of_accessors*)grib_context_malloc_clear(h->context, sizeof(grib_block_of_accessors));
+    grib_arena* arena = grib_handle_arena(h);
+    grib_section* s   = (grib_section*)grib_arena_malloc_clear(arena, sizeof(grib_section));
+    s->owner          = owner;
+    s->aclength       = NULL;
+    s->h              = h;
+    s->block          = (grib_block_of_accessors*)grib_arena_malloc_clear(arena, sizeof(grib_block_of_accessors));
     return s;
 }
 
@@ -107,35 +120,35 @@ void grib_empty_section(grib_context* c, grib_section* b)
 
 void grib_section_delete(grib_context* c, grib_section* b)
 {
+    grib_arena* arena;
     if (!b)
         return;
 
     grib_empty_section(c, b);
-    grib_context_free(c, b->block);
+    arena = grib_handle_arena(b->h);
+    grib_arena_free(arena, b->block, sizeof(grib_block_of_accessors));
     /* printf("++++ deleted %p\n",b); */
-    grib_context_free(c, b);
+    grib_arena_free(arena, b, sizeof(grib_section));
 }
 
 int grib_handle_delete(grib_handle* h)
 {
     if (h != NULL) {
-        grib_context* ct   = h->context;
-        grib_dependency* d = h->dependencies;
-        grib_dependency* n;
+        grib_context* ct = h->context;
 
         if (h->kid != NULL)
             return GRIB_INTERNAL_ERROR;
 
-        while (d) {
-            n = d->next;
-            grib_context_free(ct, d);
-            d = n;
-        }
+        /* Dependencies come from the arena */
         h->dependencies = 0;
 
         grib_buffer_delete(ct, h->buffer);
         grib_section_delete(ct, h->root);
         grib_context_free(ct, h->gts_header);
+        grib_set_pending_free(h);
+        grib_context_free(ct, h->deferred);
+        grib_context_free(ct, h->accessors);
+        grib_arena_delete(h->arena);
 
         grib_context_log(ct, GRIB_LOG_DEBUG, "grib_handle_delete: deleting handle %p", (void*)h);
         grib_context_free(ct, h);
@@ -665,15 +678,19 @@ static grib_handle* grib_handle_new_multi(grib_context* c, unsigned char** data,
             if (secnum == 7) {
                 void* p = message;
                 len     = olen;
-                grib2_build_message(c, gm->sections, gm->sections_length, &message, &len);
 
                 if (grib2_has_next_section((unsigned char*)p, olen, secbegin, seclen, &err)) {
+                    grib2_build_message(c, gm->sections, gm->sections_length, &message, &len);
                     gm->message        = (unsigned char*)p;
                     gm->section_number = secnum;
                     olen               = len;
                 }
                 else {
-                    grib_context_free(c, gm->message);
+                    /* A single field message is handed to the handle as it is */
+                    if (!grib2_sections_in_place((unsigned char*)p, olen, gm->sections, gm->sections_length)) {
+                        grib2_build_message(c, gm->sections, gm->sections_length, &message, &len);
+                        grib_context_free(c, gm->message);
+                    }
                     gm->message = NULL;
                     for (i = 0; i < 8; i++)
                         gm->sections[i] = NULL;
@@ -824,16 +841,20 @@ static grib_handle* grib_handle_new_from_file_multi(grib_context* c, FILE* f, in
             if (secnum == 7) {
                 old_data = data;
                 len      = olen;
-                grib2_build_message(c, gm->sections, gm->sections_length, &data, &len);
 
                 if (grib2_has_next_section((unsigned char*)old_data, olen, secbegin, seclen, &err)) {
+                    grib2_build_message(c, gm->sections, gm->sections_length, &data, &len);
                     gm->message        = (unsigned char*)old_data;
                     gm->section_number = secnum;
                     olen               = len;
                 }
                 else {
-                    if (gm->message)
-                        grib_context_free(c, gm->message);
+                    /* A single field message is handed to the handle as it is */
+                    if (!grib2_sections_in_place((unsigned char*)old_data, olen, gm->sections, gm->sections_length)) {
+                        grib2_build_message(c, gm->sections, gm->sections_length, &data, &len);
+                        if (gm->message)
+                            grib_context_free(c, gm->message);
+                    }
                     gm->message = NULL;
                     for (i = 0; i < 8; i++)
                         gm->sections[i] = NULL;
@@ -1536,6 +1557,7 @@ grib_action* grib_action_from_filter(const char* filter)
     }
 
     context->grib_reader = NULL;
+    context->grib_reader_ready.store(0, std::memory_order_release);
     return a;
 }
 
@@ -1644,6 +1666,23 @@ static void grib2_build_message(grib_context* context, unsigned char* sections[]
     *len = msglen;
 }
 
+/* True if the field made of these sections is the whole message, in order and in
+ * place. grib2_build_message would then only make a copy of the message */
+static bool grib2_sections_in_place(const unsigned char* message, size_t msglen, unsigned char* sections[], const size_t sections_len[])
+{
+    const unsigned char* p = message;
+    int i                  = 0;
+
+    for (i = 0; i < 8; i++) {
+        if (!sections[i])
+            continue;
+        if (sections[i] != p)
+            return false;
+        p += sections_len[i];
+    }
+    return p + 4 == message + msglen && !memcmp(p, "7777", 4);
+}
+
 /* For multi support mode: Reset all file handles equal to f. See GRIB-249 */
 void grib_multi_support_reset_file(grib_context* c, FILE* f)
 {
@@ -9767,11 +9767,13 @@ static void init()
 }
 #endif
 
+/* Nodes and ids are published with release stores: lookups of
+ * existing keys do not take the lock */
 struct grib_itrie
 {
-    grib_itrie* next[SIZE];
+    std::atomic<grib_itrie*> next[SIZE];
     grib_context* context;
-    int id;
+    std::atomic<int> id;
     int* count;
 };
 
@@ -9826,20 +9828,16 @@ static int grib_hash_keys_insert(grib_itrie* t, const char* key)
     if (*k != 0) {
         t = last;
         while (*k) {
-            int j      = mapping[(int)*k++];
-            t->next[j] = grib_hash_keys_new(t->context, count);
-            t          = t->next[j];
+            grib_itrie* n = grib_hash_keys_new(t->context, count);
+            t->next[mapping[(int)*k++]].store(n, std::memory_order_release);
+            t = n;
         }
     }
-    if (*(t->count) + TOTAL_KEYWORDS < ACCESSORS_ARRAY_SIZE) {
-        t->id = *(t->count);
+    /* Another thread may have inserted it since the lookup */
+    if (t->id == -1) {
+        t->id.store(*(t->count), std::memory_order_release);
         (*(t->count))++;
     }
-    else {
-        grib_context_log(t->context, GRIB_LOG_ERROR,
-                         "grib_hash_keys_insert: too many accessors, increase ACCESSORS_ARRAY_SIZE\n");
-        Assert(*(t->count) + TOTAL_KEYWORDS < ACCESSORS_ARRAY_SIZE);
-    }
 
     GRIB_MUTEX_UNLOCK(&mutex);
 
@@ -9861,22 +9859,15 @@ int grib_hash_keys_get_id(grib_itrie* t, const char* key)
     {
         const char* k    = key;
         grib_itrie* last = t;
-
-        GRIB_MUTEX_INIT_ONCE(&once, &init);
-        GRIB_MUTEX_LOCK(&mutex);
+        int id;
 
         while (*k && t)
-            t = t->next[mapping[(int)*k++]];
+            t = t->next[mapping[(int)*k++]].load(std::memory_order_acquire);
 
-        if (t != NULL && t->id != -1) {
-            GRIB_MUTEX_UNLOCK(&mutex);
-            return t->id + TOTAL_KEYWORDS + 1;
-        }
-        else {
-            int ret = grib_hash_keys_insert(last, key);
-            GRIB_MUTEX_UNLOCK(&mutex);
-            return ret + TOTAL_KEYWORDS + 1;
-        }
+        if (t != NULL && (id = t->id.load(std::memory_order_acquire)) != -1)
+            return id + TOTAL_KEYWORDS + 1;
+
+        return grib_hash_keys_insert(last, key) + TOTAL_KEYWORDS + 1;
     }
 }
 
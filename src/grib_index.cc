@@ -717,17 +717,13 @@ static int grib_write_index_keys(FILE* fh, grib_index_key* keys)
 
 static void grib_field_delete(grib_context* c, grib_field* field)
 {
-    int err = 0;
-
     if (!field)
         return;
 
     grib_field_delete(c, field->next);
 
-    if (field->file) {
-        grib_file_close(field->file->name, 0, &err);
-        field->file = NULL;
-    }
+    /* The file is in the pool: fields do not keep it open */
+    field->file = NULL;
 
     grib_context_free(c, field);
 }
@@ -956,6 +952,7 @@ grib_index* grib_index_read(grib_context* c, const char* filename, int* err)
         if (*err)
             return NULL;
         files[f->id] = grib_get_file(f->name, err); /* fetch from pool */
+        grib_file_close(f->name, 0, err);           /* Opened again on each get_handle */
         f            = f->next;
     }
 
@@ -1068,7 +1065,9 @@ static grib_handle* new_message_from_file(int message_type, grib_context* c, FIL
 
 #define MAX_NUM_KEYS 40
 
-static int codes_index_add_file_internal(grib_index* index, const char* filename, int message_type)
+/* Add the messages of file, already opened, to the index */
+static int index_add_messages(grib_index* index, grib_file* file, const char* filename, int message_type,
+                              size_t* pmessage_count)
 {
     double dval;
     size_t svallen;
@@ -1083,19 +1082,9 @@ static int codes_index_add_file_internal(grib_index* index, const char* filename
     grib_handle* h            = NULL;
     grib_field* field;
     grib_field_tree* field_tree;
-    grib_file* file = NULL;
-    grib_context* c;
+    grib_context* c            = index->context;
     bool warn_about_duplicates = true;
 
-    if (!index)
-        return GRIB_NULL_INDEX;
-    c = index->context;
-
-    file = grib_file_open(filename, "r", &err);
-
-    if (!file || !file->handle)
-        return err;
-
     if (!index->files) {
         grib_filesid++;
         newfile         = (grib_file*)grib_context_malloc_clear(c, sizeof(grib_file));
@@ -1105,12 +1094,6 @@ static int codes_index_add_file_internal(grib_index* index, const char* filename
         index->files    = newfile;
     }
     else {
-        indfile = index->files;
-        while (indfile) {
-            if (!strcmp(indfile->name, file->name))
-                return 0;
-            indfile = indfile->next;
-        }
         indfile = index->files;
         while (indfile->next)
             indfile = indfile->next;
@@ -1281,7 +1264,40 @@ static int codes_index_add_file_internal(grib_index* index, const char* filename
         grib_handle_delete(h);
     }/*foreach message*/
 
+    *pmessage_count = message_count;
+    return GRIB_SUCCESS;
+}
+
+static int codes_index_add_file_internal(grib_index* index, const char* filename, int message_type)
+{
+    size_t message_count = 0;
+    int err              = 0;
+    int ret              = 0;
+    grib_file* indfile   = NULL;
+    grib_file* file      = NULL;
+    grib_context* c;
+
+    if (!index)
+        return GRIB_NULL_INDEX;
+    c = index->context;
+
+    file = grib_file_open(filename, "r", &err);
+
+    if (!file || !file->handle)
+        return err;
+
+    for (indfile = index->files; indfile; indfile = indfile->next) {
+        if (!strcmp(indfile->name, file->name)) {
+            grib_file_close(file->name, 0, &err);
+            return 0;
+        }
+    }
+
+    /* Every return after the open goes through the close */
+    ret = index_add_messages(index, file, filename, message_type, &message_count);
     grib_file_close(file->name, 0, &err);
+    if (ret)
+        return ret;
 
     if (err)
         return err;
@@ -1680,10 +1696,6 @@ grib_handle* codes_index_get_handle(grib_field* field, int message_type, int* er
         return NULL;
     }
 
-    grib_file_open(field->file->name, "r", err);
-
-    if (*err != GRIB_SUCCESS)
-        return NULL;
     switch (message_type) {
         case CODES_GRIB:
             message_new = codes_grib_handle_new_from_file;
@@ -1697,11 +1709,21 @@ grib_handle* codes_index_get_handle(grib_field* field, int message_type, int* er
             return NULL;
     }
 
-    fseeko(field->file->handle, field->offset, SEEK_SET);
-    h = message_new(0, field->file->handle, err);
+    grib_file_open(field->file->name, "r", err);
     if (*err != GRIB_SUCCESS)
         return NULL;
 
+    h = grib_file_handle_new(0, field->file, field->offset, field->length, err);
+    if (*err == GRIB_NOT_IMPLEMENTED) {
+        fseeko(field->file->handle, field->offset, SEEK_SET);
+        h = message_new(0, field->file->handle, err);
+    }
+    if (*err != GRIB_SUCCESS) {
+        int cerr = 0;
+        grib_file_close(field->file->name, 0, &cerr); /* Pairs with the open above */
+        return NULL;
+    }
+
     grib_file_close(field->file->name, 0, err);
     return h;
 }
@@ -415,6 +415,41 @@ static int read_GRIB(reader* r, int no_alloc)
                     i++;
                 }
             }
+
+            if (r->headers_only && edition == 2) {
+                /* Read sections 1 to 5 of the first field and seek over the bitmap and data */
+                total_length = length;
+                for (;;) {
+                    size_t seclen = 0;
+                    GROW_BUF_IF_REQUIRED(i + 5);
+                    if (r->read(r->read_data, &tmp[i], 4, &err) != 4 || err)
+                        return err;
+                    if (tmp[i] == '7' && tmp[i + 1] == '7' && tmp[i + 2] == '7' && tmp[i + 3] == '7')
+                        break;
+                    if (r->read(r->read_data, &tmp[i + 4], 1, &err) != 1 || err)
+                        return err;
+                    if (tmp[i + 4] == 6 || tmp[i + 4] == 7)
+                        break;
+
+                    for (j = 0; j < 4; j++) {
+                        seclen <<= 8;
+                        seclen |= tmp[i + j];
+                    }
+                    if (seclen < 5 || i + seclen > total_length) {
+                        r->seek_from_start(r->read_data, r->offset + 4);
+                        grib_buffer_delete(c, buf);
+                        return GRIB_WRONG_LENGTH;
+                    }
+                    GROW_BUF_IF_REQUIRED(i + seclen);
+                    if ((r->read(r->read_data, tmp + i + 5, seclen - 5, &err) != seclen - 5) || err)
+                        return err;
+                    i += seclen;
+                }
+
+                length = i;
+                if ((err = r->seek_from_start(r->read_data, r->offset + total_length)) != GRIB_SUCCESS)
+                    return err;
+            }
             break;
 
         default:
@@ -114,17 +114,28 @@ int grib_iterator_reset(grib_iterator* i)
     return 0;
 }
 
+/* Only the one-off class initialisation needs the lock */
+static void init_iterator_class(grib_iterator_class* c)
+{
+    if (c->inited.load(std::memory_order_acquire))
+        return;
+    GRIB_MUTEX_INIT_ONCE(&once, &init_mutex);
+    GRIB_MUTEX_LOCK(&mutex);
+    if (!c->inited) {
+        if (c->init_class)
+            c->init_class(c);
+        c->inited.store(1, std::memory_order_release);
+    }
+    GRIB_MUTEX_UNLOCK(&mutex);
+}
+
 /* For this one, ALL init are called */
 static int init_iterator(grib_iterator_class* c, grib_iterator* i, grib_handle* h, grib_arguments* args)
 {
     if (c) {
         int ret                = GRIB_SUCCESS;
         grib_iterator_class* s = c->super ? *(c->super) : NULL;
-        if (!c->inited) {
-            if (c->init_class)
-                c->init_class(c);
-            c->inited = 1;
-        }
+        init_iterator_class(c);
         if (s)
             ret = init_iterator(s, i, h, args);
 
@@ -139,12 +150,7 @@ static int init_iterator(grib_iterator_class* c, grib_iterator* i, grib_handle*
 
 int grib_iterator_init(grib_iterator* i, grib_handle* h, grib_arguments* args)
 {
-    int r = 0;
-    GRIB_MUTEX_INIT_ONCE(&once, &init_mutex);
-    GRIB_MUTEX_LOCK(&mutex);
-    r = init_iterator(i->cclass, i, h, args);
-    GRIB_MUTEX_UNLOCK(&mutex);
-    return r;
+    return init_iterator(i->cclass, i, h, args);
 }
 
 /* For this one, ALL destroy are called */
@@ -299,11 +299,13 @@ static void init()
     }
 }
 #endif
+/* Nodes and ids are published with release stores: lookups of
+ * existing keys do not take the lock */
 struct grib_itrie
 {
-    grib_itrie* next[SIZE];
+    std::atomic<grib_itrie*> next[SIZE];
     grib_context* context;
-    int id;
+    std::atomic<int> id;
     int* count;
 };
 
@@ -338,26 +340,19 @@ int grib_itrie_get_id(grib_itrie* t, const char* key)
 {
     const char* k    = key;
     grib_itrie* last = t;
+    int id;
     if (!t) {
         Assert(!"grib_itrie_get_id: grib_trie==NULL");
         return -1;
     }
 
-    GRIB_MUTEX_INIT_ONCE(&once, &init);
-    GRIB_MUTEX_LOCK(&mutex);
-
     while (*k && t)
-        t = t->next[mapping[(int)*k++]];
+        t = t->next[mapping[(int)*k++]].load(std::memory_order_acquire);
 
-    if (t != NULL && t->id != -1) {
-        GRIB_MUTEX_UNLOCK(&mutex);
-        return t->id;
-    }
-    else {
-        int ret = grib_itrie_insert(last, key);
-        GRIB_MUTEX_UNLOCK(&mutex);
-        return ret;
-    }
+    if (t != NULL && (id = t->id.load(std::memory_order_acquire)) != -1)
+        return id;
+
+    return grib_itrie_insert(last, key);
 }
 
 int grib_itrie_insert(grib_itrie* t, const char* key)
@@ -386,19 +381,22 @@ int grib_itrie_insert(grib_itrie* t, const char* key)
     if (*k != 0) {
         t = last;
         while (*k) {
-            int j      = mapping[(int)*k++];
-            t->next[j] = grib_itrie_new(t->context, count);
-            t          = t->next[j];
+            grib_itrie* n = grib_itrie_new(t->context, count);
+            t->next[mapping[(int)*k++]].store(n, std::memory_order_release);
+            t = n;
         }
     }
-    if (*(t->count) < MAX_NUM_CONCEPTS) {
-        t->id = *(t->count);
-        (*(t->count))++;
-    }
-    else {
-        grib_context_log(t->context, GRIB_LOG_ERROR,
-                         "grib_itrie_insert: too many accessors, increase MAX_NUM_CONCEPTS\n");
-        Assert(*(t->count) < MAX_NUM_CONCEPTS);
+    /* Another thread may have inserted it since the lookup */
+    if (t->id == -1) {
+        if (*(t->count) < MAX_NUM_CONCEPTS) {
+            t->id.store(*(t->count), std::memory_order_release);
+            (*(t->count))++;
+        }
+        else {
+            grib_context_log(t->context, GRIB_LOG_ERROR,
+                             "grib_itrie_insert: too many accessors, increase MAX_NUM_CONCEPTS\n");
+            Assert(*(t->count) < MAX_NUM_CONCEPTS);
+        }
     }
 
     GRIB_MUTEX_UNLOCK(&mutex);
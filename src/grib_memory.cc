@@ -383,3 +383,127 @@ void* grib_buffer_realloc(const grib_context* c, void* p, size_t s)
  */
 
 #endif
+
+/* Per-handle arena.
+ * Objects that live no longer than their handle (accessors, sections, dependencies)
+ * are carved out of large chunks. Freed objects go to a free list per size class and
+ * are reused by later reparses. Deleting the arena releases everything at once;
+ * a few chunks are kept per thread for the next handle.
+ */
+#define ARENA_CHUNK_SIZE (64 * 1024)
+#define ARENA_ALIGN 16
+#define ARENA_MAX_OBJECT 1024 /* Bigger objects go to the heap */
+#define ARENA_CLASSES (ARENA_MAX_OBJECT / ARENA_ALIGN)
+#define ARENA_SPARE_CHUNKS 16
+
+typedef struct grib_arena_chunk
+{
+    struct grib_arena_chunk* next;
+    size_t used;
+} grib_arena_chunk;
+
+#define ARENA_CHUNK_HEADER ((sizeof(grib_arena_chunk) + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1))
+
+struct grib_arena
+{
+    grib_context* context;
+    grib_arena_chunk* chunks;
+    void* free_list[ARENA_CLASSES];
+};
+
+/* Chunks of deleted arenas, kept for the next handle created on this thread */
+struct arena_spares
+{
+    grib_arena_chunk* first = NULL;
+    int count               = 0;
+    ~arena_spares()
+    {
+        while (first) {
+            grib_arena_chunk* next = first->next;
+            free(first);
+            first = next;
+        }
+    }
+};
+static thread_local arena_spares spares;
+
+grib_arena* grib_arena_new(grib_context* c)
+{
+    grib_arena* a = (grib_arena*)grib_context_malloc_clear(c, sizeof(grib_arena));
+    if (a)
+        a->context = c;
+    return a;
+}
+
+void grib_arena_delete(grib_arena* a)
+{
+    grib_arena_chunk* chunk;
+    if (!a)
+        return;
+    chunk = a->chunks;
+    while (chunk) {
+        grib_arena_chunk* next = chunk->next;
+        if (spares.count < ARENA_SPARE_CHUNKS) {
+            chunk->next  = spares.first;
+            spares.first = chunk;
+            spares.count++;
+        }
+        else {
+            free(chunk);
+        }
+        chunk = next;
+    }
+    grib_context_free(a->context, a);
+}
+
+void* grib_arena_malloc_clear(grib_arena* a, size_t size)
+{
+    grib_arena_chunk* chunk;
+    size_t k;
+    void* p;
+
+    if (!a || size > ARENA_MAX_OBJECT)
+        return calloc(1, size);
+
+    size = (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+    k    = size / ARENA_ALIGN - 1;
+    if ((p = a->free_list[k]) != NULL) {
+        a->free_list[k] = *(void**)p;
+        return memset(p, 0, size);
+    }
+
+    chunk = a->chunks;
+    if (!chunk || chunk->used + size > ARENA_CHUNK_SIZE) {
+        if (spares.first) {
+            chunk        = spares.first;
+            spares.first = chunk->next;
+            spares.count--;
+        }
+        else if ((chunk = (grib_arena_chunk*)malloc(ARENA_CHUNK_SIZE)) == NULL) {
+            grib_context_log(a->context, GRIB_LOG_ERROR, "%s: error allocating %d bytes", __func__, ARENA_CHUNK_SIZE);
+            return NULL;
+        }
+        chunk->used = ARENA_CHUNK_HEADER;
+        chunk->next = a->chunks;
+        a->chunks   = chunk;
+    }
+    p = (char*)chunk + chunk->used;
+    chunk->used += size;
+    return memset(p, 0, size);
+}
+
+/* 'size' must be the one passed to grib_arena_malloc_clear */
+void grib_arena_free(grib_arena* a, void* p, size_t size)
+{
+    size_t k;
+    if (!p)
+        return;
+    if (!a || size > ARENA_MAX_OBJECT) {
+        free(p);
+        return;
+    }
+    size            = (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+    k               = size / ARENA_ALIGN - 1;
+    *(void**)p      = a->free_list[k];
+    a->free_list[k] = p;
+}
@@ -0,0 +1,233 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+// Buffered text output for the dumpers and tools which print many numbers.
+// Floating point conversions (%e, %f, %g and their upper case forms) are done with
+// std::to_chars which gives the same text as printf in the "C" locale, without the
+// cost of parsing the format and handling the locale for each value.
+// Anything else falls back to snprintf so the output is always the same as printf's.
+
+#include "grib_api_internal.h"
+#include <charconv>
+#include <clocale>
+#include <cmath>
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    #define HAVE_FLOAT_TO_CHARS 1
+#else
+    #define HAVE_FLOAT_TO_CHARS 0
+#endif
+
+void grib_output_buffer_init(grib_output_buffer* b, FILE* out)
+{
+    const struct lconv* lc = localeconv();
+    b->out                 = out;
+    b->len                 = 0;
+    b->fast_format         = HAVE_FLOAT_TO_CHARS && lc && strcmp(lc->decimal_point, ".") == 0;
+}
+
+void grib_output_buffer_flush(grib_output_buffer* b)
+{
+    if (b->len) {
+        fwrite(b->data, 1, b->len, b->out);
+        b->len = 0;
+    }
+}
+
+void grib_output_buffer_write(grib_output_buffer* b, const char* s, size_t len)
+{
+    if (b->len + len > GRIB_OUTPUT_BUFFER_SIZE) {
+        grib_output_buffer_flush(b);
+        if (len > GRIB_OUTPUT_BUFFER_SIZE) {
+            fwrite(s, 1, len, b->out);
+            return;
+        }
+    }
+    memcpy(b->data + b->len, s, len);
+    b->len += len;
+}
+
+void grib_output_buffer_puts(grib_output_buffer* b, const char* s)
+{
+    grib_output_buffer_write(b, s, strlen(s));
+}
+
+// Same as printf("%-*s", width, " ")
+void grib_output_buffer_indent(grib_output_buffer* b, int width)
+{
+    int n = width > 1 ? width : 1;
+    while (n > 0) {
+        const int k = n < 64 ? n : 64;
+        grib_output_buffer_write(b, "                                                                ", k);
+        n -= k;
+    }
+}
+
+typedef struct conversion
+{
+    int left, plus, space, zero; /* flags */
+    int width;
+    int precision; /* -1 if not given */
+    char type;
+} conversion;
+
+// Parse the conversion specification starting at p (on the '%').
+// Returns its length, or 0 if it is not one we can format without printf
+static size_t parse_conversion(const char* p, conversion* c)
+{
+    const char* q = p + 1;
+    memset(c, 0, sizeof(*c));
+    c->precision = -1;
+
+    for (;; ++q) {
+        if (*q == '-') c->left = 1;
+        else if (*q == '+') c->plus = 1;
+        else if (*q == ' ') c->space = 1;
+        else if (*q == '0') c->zero = 1;
+        else break;
+    }
+    while (*q >= '0' && *q <= '9')
+        c->width = c->width * 10 + (*q++ - '0');
+    if (*q == '.') {
+        ++q;
+        c->precision = 0;
+        while (*q >= '0' && *q <= '9')
+            c->precision = c->precision * 10 + (*q++ - '0');
+    }
+    if (*q == 'l')
+        ++q;
+    switch (*q) {
+        case 'e': case 'E': case 'f': case 'F': case 'g': case 'G':
+            c->type = *q;
+            return q - p + 1;
+        default:
+            return 0;
+    }
+}
+
+// Length of the conversion specification starting at p, whatever it is
+static size_t conversion_length(const char* p)
+{
+    const char* q = p + 1;
+    while (*q && !strchr("diouxXeEfFgGaAcspn%", *q))
+        ++q;
+    return *q ? q - p + 1 : q - p;
+}
+
+#if HAVE_FLOAT_TO_CHARS
+static size_t format_conversion(char* out, size_t size, const conversion* c, double value)
+{
+    char digits[1100];
+    char* p = digits;
+    std::chars_format fmt = std::chars_format::general;
+    const int precision   = c->precision < 0 ? 6 : c->precision;
+    size_t n = 0, pad = 0, i = 0;
+    const int is_finite = std::isfinite(value);
+
+    if (c->type == 'e' || c->type == 'E') fmt = std::chars_format::scientific;
+    if (c->type == 'f' || c->type == 'F') fmt = std::chars_format::fixed;
+
+    if (!std::signbit(value)) {
+        if (c->plus) *p++ = '+';
+        else if (c->space) *p++ = ' ';
+    }
+    std::to_chars_result r = std::to_chars(p, digits + sizeof(digits), value, fmt, precision);
+    if (r.ec != std::errc())
+        return 0;
+    if (c->type == 'E' || c->type == 'F' || c->type == 'G') {
+        for (char* s = p; s < r.ptr; ++s)
+            *s = toupper((unsigned char)*s);
+    }
+
+    n   = r.ptr - digits;
+    pad = (size_t)c->width > n ? c->width - n : 0;
+    if (n + pad > size)
+        return 0;
+
+    if (pad == 0) {
+        memcpy(out, digits, n);
+    }
+    else if (c->left) {
+        memcpy(out, digits, n);
+        memset(out + n, ' ', pad);
+    }
+    else if (c->zero && is_finite) {
+        /* Zeros go after the sign */
+        if (digits[0] == '-' || digits[0] == '+' || digits[0] == ' ')
+            out[i++] = digits[0];
+        memset(out + i, '0', pad);
+        memcpy(out + i + pad, digits + i, n - i);
+    }
+    else {
+        memset(out, ' ', pad);
+        memcpy(out + pad, digits, n);
+    }
+    return n + pad;
+}
+#endif
+
+// Format the doubles in values according to the printf format, one per conversion
+void grib_output_buffer_printf(grib_output_buffer* b, const char* format, const double* values, size_t count)
+{
+    const char* p = format;
+    size_t k = 0;
+
+    while (*p) {
+        const char* q = p;
+        while (*q && *q != '%')
+            ++q;
+        if (q > p)
+            grib_output_buffer_write(b, p, q - p);
+        if (!*q)
+            break;
+        if (q[1] == '%') {
+            grib_output_buffer_write(b, "%", 1);
+            p = q + 2;
+            continue;
+        }
+
+        conversion c;
+        size_t len = b->fast_format ? parse_conversion(q, &c) : 0;
+        const double value = k < count ? values[k++] : 0;
+        if (b->len + 1100 > GRIB_OUTPUT_BUFFER_SIZE)
+            grib_output_buffer_flush(b);
+#if HAVE_FLOAT_TO_CHARS
+        if (len) {
+            size_t n = format_conversion(b->data + b->len, GRIB_OUTPUT_BUFFER_SIZE - b->len, &c, value);
+            if (n) {
+                b->len += n;
+                p = q + len;
+                continue;
+            }
+        }
+#endif
+        /* Let printf do it */
+        char spec[64];
+        char text[1100];
+        len = conversion_length(q);
+        if (len >= sizeof(spec)) len = sizeof(spec) - 1;
+        memcpy(spec, q, len);
+        spec[len] = 0;
+        int n = snprintf(text, sizeof(text), spec, value);
+        if (n >= (int)sizeof(text)) {
+            grib_output_buffer_flush(b);
+            fprintf(b->out, spec, value);
+        }
+        else if (n > 0) {
+            grib_output_buffer_write(b, text, n);
+        }
+        p = q + len;
+    }
+}
+
+void grib_output_buffer_double(grib_output_buffer* b, const char* format, double value)
+{
+    grib_output_buffer_printf(b, format, &value, 1);
+}
@@ -70,6 +70,94 @@ static grib_accessor* search(grib_section* s, const char* name, const char* name
     return match;
 }
 
+/* The lookup cache maps a key id to the last accessor with that name, i.e. the
+ * head of its 'same' chain, or to the result of the last search for it.
+ * Open addressing with linear probing; sized to the names actually used */
+#define ACCESSOR_CACHE_MIN_SIZE 64
+
+static size_t accessor_cache_slot(size_t size, int id)
+{
+    return ((size_t)id * 2654435761u) & (size - 1);
+}
+
+grib_accessor* grib_handle_cached_accessor(const grib_handle* h, int id)
+{
+    size_t i;
+    if (id <= 0 || h->accessors_size == 0)
+        return NULL;
+
+    i = accessor_cache_slot(h->accessors_size, id);
+    while (h->accessors[i].id) {
+        if (h->accessors[i].id == id)
+            return h->accessors[i].accessor;
+        i = (i + 1) & (h->accessors_size - 1);
+    }
+    return NULL;
+}
+
+static int accessor_cache_grow(grib_handle* h)
+{
+    size_t i, size = h->accessors_size ? 2 * h->accessors_size : ACCESSOR_CACHE_MIN_SIZE;
+    grib_accessor_cache_entry* e =
+        (grib_accessor_cache_entry*)grib_context_malloc_clear(h->context, size * sizeof(grib_accessor_cache_entry));
+    if (!e)
+        return GRIB_OUT_OF_MEMORY;
+
+    /* Slots holding no accessor are not carried over */
+    h->accessors_count = 0;
+    for (i = 0; i < h->accessors_size; i++) {
+        if (h->accessors[i].accessor) {
+            size_t j = accessor_cache_slot(size, h->accessors[i].id);
+            while (e[j].id)
+                j = (j + 1) & (size - 1);
+            e[j] = h->accessors[i];
+            h->accessors_count++;
+        }
+    }
+    grib_context_free(h->context, h->accessors);
+    h->accessors      = e;
+    h->accessors_size = size;
+    return GRIB_SUCCESS;
+}
+
+void grib_handle_cache_accessor(grib_handle* h, int id, grib_accessor* a)
+{
+    size_t i;
+    if (id <= 0)
+        return;
+
+    if (h->accessors_size) {
+        i = accessor_cache_slot(h->accessors_size, id);
+        while (h->accessors[i].id) {
+            if (h->accessors[i].id == id) {
+                h->accessors[i].accessor = a;
+                return;
+            }
+            i = (i + 1) & (h->accessors_size - 1);
+        }
+    }
+    if (a == NULL)
+        return;
+
+    /* Keep the load factor below one half */
+    if (2 * (h->accessors_count + 1) > h->accessors_size && accessor_cache_grow(h) != GRIB_SUCCESS)
+        return;
+
+    i = accessor_cache_slot(h->accessors_size, id);
+    while (h->accessors[i].id)
+        i = (i + 1) & (h->accessors_size - 1);
+    h->accessors[i].id       = id;
+    h->accessors[i].accessor = a;
+    h->accessors_count++;
+}
+
+void grib_handle_clear_accessor_cache(grib_handle* h)
+{
+    if (h->accessors_size)
+        memset(h->accessors, 0, h->accessors_size * sizeof(grib_accessor_cache_entry));
+    h->accessors_count = 0;
+}
+
 static void rebuild_hash_keys(grib_handle* h, grib_section* s)
 {
     grib_accessor* a = s ? s->block->first : NULL;
@@ -86,9 +174,9 @@ static void rebuild_hash_keys(grib_handle* h, grib_section* s)
                 id = grib_hash_keys_get_id(a->context->keys, p);
 
                 if (a->same != a && i == 0) {
-                    grib_handle* hand   = grib_handle_of_accessor(a);
-                    a->same             = hand->accessors[id];
-                    hand->accessors[id] = a;
+                    grib_handle* hand = grib_handle_of_accessor(a);
+                    a->same           = grib_handle_cached_accessor(hand, id);
+                    grib_handle_cache_accessor(hand, id, a);
                     DEBUG_ASSERT(a->same != a);
                 }
             }
@@ -99,6 +187,151 @@ static void rebuild_hash_keys(grib_handle* h, grib_section* s)
     }
 }
 
+static int accessor_in_section(const grib_accessor* a, const grib_section* s)
+{
+    const grib_section* p = a->parent;
+    while (p) {
+        if (p == s)
+            return 1;
+        p = p->owner ? p->owner->parent : NULL;
+    }
+    return 0;
+}
+
+/* Whether 'a', which is not in section 's', comes after it in the order
+ * rebuild_hash_keys visits accessors: 1 if after, 0 if before, -1 if unrelated */
+static int accessor_after_section(const grib_accessor* a, const grib_section* s)
+{
+    while (a && a->parent) {
+        const grib_section* p    = s;
+        const grib_accessor* pos = NULL;
+        const grib_accessor* b;
+
+        /* Accessor of a->parent that s descends from */
+        while (p && p != a->parent) {
+            pos = p->owner;
+            p   = pos ? pos->parent : NULL;
+        }
+        if (p) {
+            if (!pos)
+                return -1;
+            if (pos == a)
+                return 0; /* a owns s */
+            for (b = p->block->first; b; b = b->next_) {
+                if (b == a)
+                    return 0;
+                if (b == pos)
+                    return 1;
+            }
+            return -1;
+        }
+        a = a->parent->owner;
+    }
+    return -1;
+}
+
+static int same_name(const grib_accessor* a, const grib_accessor* b)
+{
+    return strcmp(a->all_names[0], b->all_names[0]) == 0;
+}
+
+/* Take the accessors of section s out of the 'same' chains */
+static int unlink_section_accessors(grib_handle* h, grib_section* s)
+{
+    grib_accessor* a = s ? s->block->first : NULL;
+    int err;
+
+    for (; a; a = a->next_) {
+        if (a->all_names[0] && *(a->all_names[0]) != '_' && a->same != a) {
+            int id              = grib_hash_keys_get_id(a->context->keys, a->all_names[0]);
+            grib_accessor* head = grib_handle_cached_accessor(h, id);
+            grib_accessor *prev = NULL, *cur;
+
+            if (!head || !same_name(head, a))
+                return GRIB_INTERNAL_ERROR;
+
+            for (cur = head; cur; cur = cur->same) {
+                if (accessor_in_section(cur, s)) {
+                    if (prev)
+                        prev->same = cur->same;
+                    else
+                        head = cur->same;
+                }
+                else {
+                    prev = cur;
+                }
+            }
+            grib_handle_cache_accessor(h, id, head);
+        }
+        if ((err = unlink_section_accessors(h, a->sub_section)) != GRIB_SUCCESS)
+            return err;
+    }
+    return GRIB_SUCCESS;
+}
+
+/* Insert the accessors of section 'from', which replace those of section s,
+ * into the 'same' chains at the position s has in the message */
+static int link_section_accessors(grib_handle* h, grib_section* from, const grib_section* s, const grib_section* sub)
+{
+    grib_accessor* a = sub ? sub->block->first : NULL;
+    int err;
+
+    for (; a; a = a->next_) {
+        if (a->all_names[0] && *(a->all_names[0]) != '_' && a->same != a) {
+            int id              = grib_hash_keys_get_id(a->context->keys, a->all_names[0]);
+            grib_accessor* head = grib_handle_cached_accessor(h, id);
+            grib_accessor *prev = NULL, *cur;
+
+            if (head && !same_name(head, a))
+                return GRIB_INTERNAL_ERROR;
+
+            for (cur = head; cur && !accessor_in_section(cur, from); cur = cur->same) {
+                int after = accessor_after_section(cur, s);
+                if (after < 0)
+                    return GRIB_INTERNAL_ERROR;
+                if (!after)
+                    break;
+                prev = cur;
+            }
+            a->same = cur;
+            if (prev)
+                prev->same = a;
+            else
+                grib_handle_cache_accessor(h, id, a);
+        }
+        if ((err = link_section_accessors(h, from, s, a->sub_section)) != GRIB_SUCCESS)
+            return err;
+    }
+    return GRIB_SUCCESS;
+}
+
+/* Called when the accessors of section s are about to be replaced by those of
+ * section 'from' (see action_class_section.cc): only the keys of s are updated
+ * instead of rebuilding the whole cache. On error the cache must be rebuilt */
+int grib_handle_replace_cached_section(grib_handle* h, grib_section* s, grib_section* from)
+{
+    size_t i;
+    int err;
+
+    if (!h->use_trie || h->trie_invalid)
+        return GRIB_INTERNAL_ERROR;
+
+    if ((err = unlink_section_accessors(h, s)) != GRIB_SUCCESS)
+        return err;
+    if ((err = link_section_accessors(h, from, s, from)) != GRIB_SUCCESS)
+        return err;
+
+    /* As after a rebuild, keep only the heads of the chains: aliases and
+     * search results are looked up again */
+    for (i = 0; i < h->accessors_size; i++) {
+        grib_accessor* a = h->accessors[i].accessor;
+        if (a && (accessor_in_section(a, s) || !a->all_names[0] || *(a->all_names[0]) == '_' ||
+                  grib_hash_keys_get_id(a->context->keys, a->all_names[0]) != h->accessors[i].id))
+            h->accessors[i].accessor = NULL;
+    }
+    return GRIB_SUCCESS;
+}
+
 static grib_accessor* search_and_cache(grib_handle* h, const char* name, const char* the_namespace);
 
 static grib_accessor* _search_and_cache(grib_handle* h, const char* name, const char* the_namespace)
@@ -108,9 +341,7 @@ static grib_accessor* _search_and_cache(grib_handle* h, const char* name, const
         int id           = -1;
 
         if (h->trie_invalid && h->kid == NULL) {
-            int i = 0;
-            for (i = 0; i < ACCESSORS_ARRAY_SIZE; i++)
-                h->accessors[i] = NULL;
+            grib_handle_clear_accessor_cache(h);
 
             if (h->root)
                 rebuild_hash_keys(h, h->root);
@@ -121,13 +352,13 @@ static grib_accessor* _search_and_cache(grib_handle* h, const char* name, const
         else {
             id = grib_hash_keys_get_id(h->context->keys, name);
 
-            if ((a = h->accessors[id]) != NULL &&
+            if ((a = grib_handle_cached_accessor(h, id)) != NULL &&
                 (the_namespace == NULL || matching(a, name, the_namespace)))
                 return a;
         }
 
-        a                = search(h->root, name, the_namespace);
-        h->accessors[id] = a;
+        a = search(h->root, name, the_namespace);
+        grib_handle_cache_accessor(h, id, a);
 
         return a;
     }
@@ -608,6 +839,27 @@ grib_accessor* grib_find_accessor(const grib_handle* h, const char* name)
 //     return act;
 // }
 
+/* As grib_find_accessor for a plain key name (no namespace, rank or attribute)
+ * whose id in the context keys was looked up beforehand */
+grib_accessor* grib_find_accessor_by_id(const grib_handle* ch, const char* name, int id)
+{
+    grib_handle* h   = (grib_handle*)ch;
+    grib_accessor* a = NULL;
+
+    if (!h->use_trie || (h->trie_invalid && h->kid == NULL))
+        return grib_find_accessor(h, name);
+
+    if ((a = grib_handle_cached_accessor(h, id)) == NULL) {
+        a = search(h->root, name, NULL);
+        grib_handle_cache_accessor(h, id, a);
+    }
+
+    if (a == NULL && h->main)
+        a = grib_find_accessor_by_id(h->main, name, id);
+
+    return a;
+}
+
 /* Only look in trie. Used only in alias. Should not be used in other cases.*/
 grib_accessor* grib_find_accessor_fast(grib_handle* h, const char* name)
 {
@@ -627,12 +879,12 @@ grib_accessor* grib_find_accessor_fast(grib_handle* h, const char* name)
 
         name_space[len] = '\0';
 
-        a = h->accessors[grib_hash_keys_get_id(h->context->keys, name)];
+        a = grib_handle_cached_accessor(h, grib_hash_keys_get_id(h->context->keys, name));
         if (a && !matching(a, name, name_space))
             a = NULL;
     }
     else {
-        a = h->accessors[grib_hash_keys_get_id(h->context->keys, name)];
+        a = grib_handle_cached_accessor(h, grib_hash_keys_get_id(h->context->keys, name));
     }
 
     if (a == NULL && h->main)
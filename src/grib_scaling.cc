@@ -76,6 +76,46 @@ long grib_get_binary_scale_fact(double max, double min, long bpval, int* error)
     return scale;
 }
 
+// Bounds of the values of a field packed as (R + X * 2^E) * 10^-D with X on bitsPerValue bits.
+// The decoders evaluate the same monotonic expression so the bounds are guaranteed.
+// They are exact only for constant fields (bitsPerValue=0)
+int grib_get_packed_value_bounds(grib_handle* h, const char* reference_value, const char* binary_scale_factor,
+                                 const char* decimal_scale_factor, const char* bits_per_value,
+                                 double* lo, double* hi, int* exact)
+{
+    int err = 0;
+    double R = 0;
+    long E = 0, D = 0, bpv = 0;
+
+    if ((err = grib_get_long_internal(h, bits_per_value, &bpv)) != GRIB_SUCCESS)
+        return err;
+    if ((err = grib_get_double_internal(h, reference_value, &R)) != GRIB_SUCCESS)
+        return err;
+
+    if (bpv == 0) {
+        // Constant field: the decoders return the reference value as is
+        *lo = *hi = R;
+        *exact = 1;
+        return GRIB_SUCCESS;
+    }
+    if (bpv > (long)(sizeof(unsigned long) * 8))
+        return GRIB_INVALID_BPV;
+
+    if ((err = grib_get_long_internal(h, binary_scale_factor, &E)) != GRIB_SUCCESS)
+        return err;
+    if ((err = grib_get_long_internal(h, decimal_scale_factor, &D)) != GRIB_SUCCESS)
+        return err;
+
+    const double s = codes_power<double>(E, 2);
+    const double d = codes_power<double>(-D, 10);
+    const unsigned long xmax = (bpv == (long)(sizeof(unsigned long) * 8)) ? (unsigned long)-1 : (1UL << bpv) - 1;
+
+    *lo    = R * d;
+    *hi    = ((xmax * s) + R) * d;
+    *exact = 0;
+    return GRIB_SUCCESS;
+}
+
 // long grib_get_bits_per_value(double max, double min, long binary_scale_factor)
 // {
 //     double range    = max - min;
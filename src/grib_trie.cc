@@ -316,13 +316,15 @@ static void init()
 }
 #endif
 
+/* Nodes and data are only added, with release stores, so that
+ * grib_trie_get can walk the trie without taking the lock */
 struct grib_trie
 {
-    grib_trie* next[SIZE];
+    std::atomic<grib_trie*> next[SIZE];
     grib_context* context;
     int first;
     int last;
-    void* data;
+    std::atomic<void*> data;
 };
 
 grib_trie* grib_trie_new(grib_context* c)
@@ -365,7 +367,7 @@ void grib_trie_delete(grib_trie* t)
         int i;
         for (i = t->first; i <= t->last; i++)
             if (t->next[i]) {
-                grib_context_free(t->context, t->next[i]->data);
+                grib_context_free(t->context, t->next[i].load()->data);
                 grib_trie_delete(t->next[i]);
             }
 #ifdef RECYCLE_TRIE
@@ -388,6 +390,8 @@ void grib_trie_clear(grib_trie* t)
     }
 }
 
+/* Returns the value replaced, if any. grib_trie_get does not lock, so a reader may
+ * still hold that value: only free it if the trie is not shared between threads */
 void* grib_trie_insert(grib_trie* t, const char* key, void* data)
 {
     grib_trie* last = t;
@@ -410,25 +414,23 @@ void* grib_trie_insert(grib_trie* t, const char* key, void* data)
             k++;
     }
 
-    if (*k == 0) {
-        old     = t->data;
-        t->data = data;
-    }
-    else {
+    if (*k != 0) {
         t = last;
         while (*k) {
-            int j = 0;
+            grib_trie* n = grib_trie_new(t->context);
+            int j        = 0;
             DebugCheckBounds((int)*k, key);
             j = mapping[(int)*k++];
             if (j < t->first)
                 t->first = j;
             if (j > t->last)
                 t->last = j;
-            t = t->next[j] = grib_trie_new(t->context);
+            t->next[j].store(n, std::memory_order_release);
+            t = n;
         }
-        old     = t->data;
-        t->data = data;
     }
+    old = t->data;
+    t->data.store(data, std::memory_order_release);
     GRIB_MUTEX_UNLOCK(&mutex);
     return data == old ? NULL : old;
 }
@@ -437,12 +439,17 @@ void* grib_trie_insert_no_replace(grib_trie* t, const char* key, void* data)
 {
     grib_trie* last = t;
     const char* k   = key;
+    void* result    = NULL;
 
     if (!t) {
         Assert(!"grib_trie_insert_no_replace: grib_trie==NULL");
         return NULL;
     }
 
+    /* Readers do not lock but writers do, as in grib_trie_insert */
+    GRIB_MUTEX_INIT_ONCE(&once, &init);
+    GRIB_MUTEX_LOCK(&mutex);
+
     while (*k && t) {
         last = t;
         DebugCheckBounds((int)*k, key);
@@ -454,39 +461,39 @@ void* grib_trie_insert_no_replace(grib_trie* t, const char* key, void* data)
     if (*k != 0) {
         t = last;
         while (*k) {
-            int j = 0;
+            grib_trie* n = grib_trie_new(t->context);
+            int j        = 0;
             DebugCheckBounds((int)*k, key);
             j = mapping[(int)*k++];
             if (j < t->first)
                 t->first = j;
             if (j > t->last)
                 t->last = j;
-            t = t->next[j] = grib_trie_new(t->context);
+            t->next[j].store(n, std::memory_order_release);
+            t = n;
         }
     }
 
     if (!t->data)
-        t->data = data;
+        t->data.store(data, std::memory_order_release);
+    result = t->data;
 
-    return t->data;
+    GRIB_MUTEX_UNLOCK(&mutex);
+    return result;
 }
 
+/* Lock-free: concurrent inserts are only seen once complete */
 void* grib_trie_get(grib_trie* t, const char* key)
 {
     const char* k = key;
-    GRIB_MUTEX_INIT_ONCE(&once, &init);
-    GRIB_MUTEX_LOCK(&mutex);
 
     while (*k && t) {
         DebugCheckBounds((int)*k, key);
-        t = t->next[mapping[(int)*k++]];
+        t = t->next[mapping[(int)*k++]].load(std::memory_order_acquire);
     }
 
-    if (*k == 0 && t != NULL && t->data != NULL) {
-        GRIB_MUTEX_UNLOCK(&mutex);
-        return t->data;
-    }
-    GRIB_MUTEX_UNLOCK(&mutex);
+    if (*k == 0 && t != NULL)
+        return t->data.load(std::memory_order_acquire);
     return NULL;
 }
 
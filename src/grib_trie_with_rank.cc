@@ -526,3 +526,23 @@ void* grib_trie_with_rank_get(grib_trie_with_rank* t, const char* key, int rank)
     GRIB_MUTEX_UNLOCK(&mutex);
     return NULL;
 }
+
+/* All the objects inserted with key, in order of rank. NULL if there are none */
+grib_oarray* grib_trie_with_rank_get_all(grib_trie_with_rank* t, const char* key)
+{
+    const char* k     = key;
+    grib_oarray* objs = NULL;
+    GRIB_MUTEX_INIT_ONCE(&once, &init);
+
+    GRIB_MUTEX_LOCK(&mutex);
+
+    while (*k && t) {
+        DebugCheckBounds((int)*k, key);
+        t = t->next[mapping[(int)*k++]];
+    }
+
+    if (*k == 0 && t != NULL)
+        objs = t->objs;
+    GRIB_MUTEX_UNLOCK(&mutex);
+    return objs;
+}
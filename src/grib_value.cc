@@ -62,6 +62,142 @@ static void print_debug_info__set_array(grib_handle* h, const char* func, const
     fprintf(stderr, "min=%.10g, max=%.10g\n",minVal,maxVal);
 }
 
+/* Set transactions: scalar values are recorded on the handle by grib_set_long and
+ * friends between grib_set_begin and grib_set_commit. A key recorded twice keeps
+ * its last value */
+static int set_pending_add(grib_handle* h, const char* name, int type, long lval, double dval, const char* sval)
+{
+    grib_context* c = h->context;
+    grib_values* v  = NULL;
+    size_t i        = 0;
+
+    for (i = 0; i < h->set_pending_count; i++) {
+        if (strcmp(h->set_pending[i].name, name) == 0) {
+            v = &h->set_pending[i];
+            grib_context_free(c, (char*)v->string_value);
+            v->string_value = NULL;
+            break;
+        }
+    }
+    if (!v) {
+        if (h->set_pending_count == h->set_pending_size) {
+            size_t size         = h->set_pending_size ? 2 * h->set_pending_size : 16;
+            grib_values* values = (grib_values*)grib_context_realloc(c, h->set_pending, size * sizeof(grib_values));
+            if (!values)
+                return GRIB_OUT_OF_MEMORY;
+            h->set_pending      = values;
+            h->set_pending_size = size;
+        }
+        v = &h->set_pending[h->set_pending_count];
+        memset(v, 0, sizeof(grib_values));
+        v->name = grib_context_strdup(c, name);
+        if (!v->name)
+            return GRIB_OUT_OF_MEMORY;
+        h->set_pending_count++;
+    }
+
+    v->type         = type;
+    v->long_value   = lval;
+    v->double_value = dval;
+    if (sval) {
+        v->string_value = grib_context_strdup(c, sval);
+        if (!v->string_value)
+            return GRIB_OUT_OF_MEMORY;
+    }
+    return GRIB_SUCCESS;
+}
+
+void grib_set_pending_free(grib_handle* h)
+{
+    size_t i = 0;
+    for (i = 0; i < h->set_pending_count; i++) {
+        grib_context_free(h->context, (char*)h->set_pending[i].name);
+        grib_context_free(h->context, (char*)h->set_pending[i].string_value);
+    }
+    grib_context_free(h->context, h->set_pending);
+    h->set_pending       = NULL;
+    h->set_pending_count = 0;
+    h->set_pending_size  = 0;
+}
+
+/* Does changing this key trigger the rebuild of a section? */
+static int is_section_selector(grib_handle* h, const char* name)
+{
+    const grib_accessor* a = grib_find_accessor(h, name);
+    const grib_dependency* d = NULL;
+
+    if (!a)
+        return 0;
+    for (d = h->dependencies; d; d = d->next) {
+        if (d->observed == a && d->observer)
+            return 1;
+    }
+    return 0;
+}
+
+/* Apply the recorded values: template selectors first, each affected section rebuilt once */
+static int set_pending_apply(grib_handle* h)
+{
+    grib_values* args = NULL;
+    size_t count      = h->set_pending_count;
+    size_t i = 0, n = 0;
+    int err           = 0;
+
+    if (count == 0)
+        return GRIB_SUCCESS;
+
+    args = (grib_values*)grib_context_malloc(h->context, count * sizeof(grib_values));
+    if (!args)
+        return GRIB_OUT_OF_MEMORY;
+    for (i = 0; i < count; i++)
+        if (is_section_selector(h, h->set_pending[i].name))
+            args[n++] = h->set_pending[i];
+    for (i = 0; i < count; i++)
+        if (!is_section_selector(h, h->set_pending[i].name))
+            args[n++] = h->set_pending[i];
+    Assert(n == count);
+
+    h->set_deferring = 1;
+    err              = grib_set_values(h, args, count);
+    h->set_deferring = 0;
+    h->deferred_count = 0;
+
+    grib_context_free(h->context, args);
+    return err;
+}
+
+int grib_set_begin(grib_handle* h)
+{
+    if (h->set_recording) {
+        grib_context_log(h->context, GRIB_LOG_ERROR, "%s: A set transaction is already open", __func__);
+        return GRIB_INVALID_ARGUMENT;
+    }
+    h->set_recording = 1;
+    return GRIB_SUCCESS;
+}
+
+int grib_set_commit(grib_handle* h)
+{
+    int err = 0;
+    if (!h->set_recording) {
+        grib_context_log(h->context, GRIB_LOG_ERROR, "%s: No set transaction is open", __func__);
+        return GRIB_INVALID_ARGUMENT;
+    }
+    h->set_recording = 0;
+    err              = set_pending_apply(h);
+    grib_set_pending_free(h);
+    return err;
+}
+
+/* Array keys are not recorded. Apply what is pending and stop recording for the duration of the call */
+static int set_transaction_suspend(grib_handle* h)
+{
+    int err          = set_pending_apply(h);
+    h->set_recording = 0;
+    grib_set_pending_free(h);
+    return err;
+}
+
 int grib_set_expression(grib_handle* h, const char* name, grib_expression* e)
 {
     grib_accessor* a = grib_find_accessor(h, name);
@@ -113,6 +249,9 @@ int grib_set_long(grib_handle* h, const char* name, long val)
     grib_accessor* a = NULL;
     size_t l         = 1;
 
+    if (h->set_recording)
+        return set_pending_add(h, name, GRIB_TYPE_LONG, val, 0, NULL);
+
     a = grib_find_accessor(h, name);
 
     if (a) {
@@ -345,6 +484,9 @@ int grib_set_double(grib_handle* h, const char* name, double val)
     grib_accessor* a = NULL;
     size_t l         = 1;
 
+    if (h->set_recording)
+        return set_pending_add(h, name, GRIB_TYPE_DOUBLE, 0, val, NULL);
+
     a = grib_find_accessor(h, name);
 
     if (a) {
@@ -458,8 +600,12 @@ int grib_set_string(grib_handle* h, const char* name, const char* val, size_t* l
 {
     int ret          = 0;
     grib_accessor* a = NULL;
+    int processed    = 0;
+
+    if (h->set_recording)
+        return set_pending_add(h, name, GRIB_TYPE_STRING, 0, 0, val);
 
-    int processed = process_packingType_change(h, name, val);
+    processed = process_packingType_change(h, name, val);
     if (processed)
         return GRIB_SUCCESS;  /* Dealt with - no further action needed */
 
@@ -495,6 +641,13 @@ int grib_set_string_array(grib_handle* h, const char* name, const char** val, si
     int ret = 0;
     grib_accessor* a;
 
+    if (h->set_recording) {
+        if ((ret = set_transaction_suspend(h)) == GRIB_SUCCESS)
+            ret = grib_set_string_array(h, name, val, length);
+        h->set_recording = 1;
+        return ret;
+    }
+
     a = grib_find_accessor(h, name);
 
     if (h->context->debug) {
@@ -535,8 +688,16 @@ int grib_set_string_array(grib_handle* h, const char* name, const char** val, si
 int grib_set_bytes(grib_handle* h, const char* name, const unsigned char* val, size_t* length)
 {
     int ret          = 0;
-    grib_accessor* a = grib_find_accessor(h, name);
+    grib_accessor* a = NULL;
+
+    if (h->set_recording) {
+        if ((ret = set_transaction_suspend(h)) == GRIB_SUCCESS)
+            ret = grib_set_bytes(h, name, val, length);
+        h->set_recording = 1;
+        return ret;
+    }
 
+    a = grib_find_accessor(h, name);
     if (a) {
         /* if(a->flags & GRIB_ACCESSOR_FLAG_READ_ONLY) */
         /* return GRIB_READ_ONLY; */
@@ -572,6 +733,9 @@ int grib_set_missing(grib_handle* h, const char* name)
     int ret          = 0;
     grib_accessor* a = NULL;
 
+    if (h->set_recording)
+        return set_pending_add(h, name, GRIB_TYPE_MISSING, 0, 0, NULL);
+
     a = grib_find_accessor(h, name);
 
     if (a) {
@@ -843,6 +1007,13 @@ int grib_set_force_double_array(grib_handle* h, const char* name, const double*
 {
     /* GRIB-285: Same as grib_set_double_array but allows setting of READ-ONLY keys like codedValues */
     /* Use with great caution!! */
+    if (h->set_recording) {
+        int ret = set_transaction_suspend(h);
+        if (ret == GRIB_SUCCESS)
+            ret = __grib_set_double_array(h, name, val, length, /*check=*/0);
+        h->set_recording = 1;
+        return ret;
+    }
     return __grib_set_double_array(h, name, val, length, /*check=*/0);
 }
 int grib_set_force_float_array(grib_handle* h, const char* name, const float* val, size_t length)
@@ -855,6 +1026,13 @@ int grib_set_force_float_array(grib_handle* h, const char* name, const float* va
 
 int grib_set_double_array(grib_handle* h, const char* name, const double* val, size_t length)
 {
+    if (h->set_recording) {
+        int ret = set_transaction_suspend(h);
+        if (ret == GRIB_SUCCESS)
+            ret = __grib_set_double_array(h, name, val, length, /*check=*/1);
+        h->set_recording = 1;
+        return ret;
+    }
     return __grib_set_double_array(h, name, val, length, /*check=*/1);
 }
 int grib_set_float_array(grib_handle* h, const char* name, const float* val, size_t length)
@@ -942,6 +1120,13 @@ int grib_set_long_array_internal(grib_handle* h, const char* name, const long* v
 
 int grib_set_long_array(grib_handle* h, const char* name, const long* val, size_t length)
 {
+    if (h->set_recording) {
+        int ret = set_transaction_suspend(h);
+        if (ret == GRIB_SUCCESS)
+            ret = _grib_set_long_array(h, name, val, length, 1);
+        h->set_recording = 1;
+        return ret;
+    }
     return _grib_set_long_array(h, name, val, length, 1);
 }
 
@@ -1091,6 +1276,17 @@ int grib_get_float_element(const grib_handle* h, const char* name, int i, float*
     return GRIB_NOT_FOUND;
 }
 
+int grib_get_value_bounds(const grib_handle* h, double* lo, double* hi, int* exact)
+{
+    grib_accessor* act = grib_find_accessor(h, "values");
+
+    if (act) {
+        *exact = 0;
+        return act->unpack_value_bounds(lo, hi, exact);
+    }
+    return GRIB_NOT_FOUND;
+}
+
 int grib_get_double_element_set_internal(grib_handle* h, const char* name, const size_t* index_array, size_t len, double* val_array)
 {
     int ret = grib_get_double_element_set(h, name, index_array, len, val_array);
@@ -1271,6 +1467,15 @@ int grib_get_native_type(const grib_handle* h, const char* name, int* type)
 //     return act ? act->cclass->name : NULL;
 // }
 
+/* Returns GRIB_NOT_FOUND, with a clearer message when the handle has no data section */
+static int array_not_found(const grib_handle* h, const char* name)
+{
+    if (h->partial)
+        grib_context_log(h->context, GRIB_LOG_ERROR,
+                         "Cannot get \"%s\": message was decoded with headers only (no data sections)", name);
+    return GRIB_NOT_FOUND;
+}
+
 template <typename T>
 static int _grib_get_array_internal(const grib_handle* h, grib_accessor* a, T* val, size_t buffer_len, size_t* decoded_length)
 {
@@ -1324,7 +1529,7 @@ int grib_get_double_array(const grib_handle* h, const char* name, double* val, s
     else {
         a = grib_find_accessor(h, name);
         if (!a)
-            return GRIB_NOT_FOUND;
+            return array_not_found(h, name);
         if (name[0] == '#') {
             return a->unpack_double(val, length);
         }
@@ -1339,7 +1544,7 @@ int grib_get_float_array(const grib_handle* h, const char* name, float* val, siz
 {
     size_t len = *length;
     grib_accessor* a = grib_find_accessor(h, name);
-    if (!a) return GRIB_NOT_FOUND;
+    if (!a) return array_not_found(h, name);
 
     //[> TODO: For now only GRIB supported... no BUFR keys <]
     if (h->product_kind != PRODUCT_GRIB) {
@@ -1761,8 +1966,20 @@ int grib_set_values(grib_handle* h, grib_values* args, size_t count)
     int err = 0;
     size_t len;
     int more  = 1;
-    int stack = h->values_stack++;
+    int stack = 0;
+    grib_accessor* current = h->set_current;
+
+    if (h->set_recording) {
+        for (i = 0; i < count; i++) {
+            args[i].error = set_pending_add(h, args[i].name, args[i].type, args[i].long_value,
+                                            args[i].double_value, args[i].string_value);
+            if (args[i].error != GRIB_SUCCESS)
+                err = args[i].error;
+        }
+        return err;
+    }
 
+    stack = h->values_stack++;
     Assert(h->values_stack < MAX_SET_VALUES - 1);
 
     h->values[stack]       = args;
@@ -1783,6 +2000,10 @@ int grib_set_values(grib_handle* h, grib_values* args, size_t count)
             if (args[i].error != GRIB_NOT_FOUND)
                 continue;
 
+            /* Only the sections triggered by our own keys are deferred */
+            if (h->set_deferring)
+                h->set_current = grib_find_accessor(h, args[i].name);
+
             switch (args[i].type) {
                 case GRIB_TYPE_LONG:
                     error         = grib_set_long(h, args[i].name, args[i].long_value);
@@ -1815,12 +2036,33 @@ int grib_set_values(grib_handle* h, grib_values* args, size_t count)
                     args[i].error = GRIB_INVALID_ARGUMENT;
                     break;
             }
+            h->set_current = current;
             /*if (args[i].error != GRIB_SUCCESS)
          grib_context_log(h->context,GRIB_LOG_ERROR,"Unable to set %s (%s)",
                           args[i].name,grib_get_error_message(args[i].error)); */
         }
+
+        /* Keys still missing may live in a section whose rebuild was deferred */
+        if (h->deferred_count > 0) {
+            int missing = 0;
+            for (i = 0; i < count; i++) {
+                if (args[i].error == GRIB_NOT_FOUND) {
+                    missing = 1;
+                    break;
+                }
+            }
+            if (missing) {
+                if ((err = grib_section_reparse_deferred(h)) != GRIB_SUCCESS)
+                    break;
+                more = 1;
+            }
+        }
     }
 
+    /* The values being set must still be on the stack when the sections are rebuilt */
+    if (h->set_deferring && stack == 0 && err == GRIB_SUCCESS)
+        err = grib_section_reparse_deferred(h);
+
     h->values[stack]       = NULL;
     h->values_count[stack] = 0;
 
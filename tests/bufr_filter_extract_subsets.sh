@@ -180,6 +180,59 @@ diff ${f}.log.ref ${f}.log
 
 rm -f ${f}.log ${f}.log.ref $fBufrTmp1 $fLog $fRules
 #-----------------------------------------------------------
+# Test: Grid box thinning
+#-----------------------------------------------------------
+f="imssnow.bufr"
+
+echo "Test: Grid box thinning" >> $fLog
+echo "file: $f" >> $fLog
+
+# One box for the whole globe keeps a single subset
+cat > $fRules <<EOF
+set gridBoxThinningLatitudeIncrement=180;
+set gridBoxThinningLongitudeIncrement=360;
+set doGridBoxThinning=1;
+assert(gridBoxThinningNumberOfSubsets == 1);
+write;
+EOF
+${tools_dir}/codes_bufr_filter -o $fBufrTmp1 $fRules $f
+ns=`${tools_dir}/bufr_get -p numberOfSubsets $fBufrTmp1`
+[ $ns -eq 1 ]
+
+# With a priority key the subset kept has its largest value
+cat > $fRules <<EOF
+set gridBoxThinningLatitudeIncrement=180;
+set gridBoxThinningLongitudeIncrement=360;
+set gridBoxThinningPriorityKey="height";
+set doGridBoxThinning=1;
+write;
+EOF
+${tools_dir}/codes_bufr_filter -o $fBufrTmp1 $fRules $f
+max=`echo 'set unpack=1; print "[height!1]";' | ${tools_dir}/codes_bufr_filter - $f | sort -n | tail -1`
+kept=`echo 'set unpack=1; print "[height]";' | ${tools_dir}/codes_bufr_filter - $fBufrTmp1`
+[ $kept -eq $max ]
+
+cat > $fRules <<EOF
+set gridBoxThinningLatitudeIncrement=5;
+set gridBoxThinningLongitudeIncrement=5;
+set doGridBoxThinning=1;
+write;
+print "[gridBoxThinningNumberOfSubsets]";
+EOF
+${tools_dir}/codes_bufr_filter -o $fBufrTmp1 $fRules $f > ${f}.log
+ns=`${tools_dir}/bufr_get -p numberOfSubsets $fBufrTmp1`
+[ $ns -eq `cat ${f}.log` ]
+
+# Bad increment
+set +e
+echo 'set gridBoxThinningLatitudeIncrement=0; set doGridBoxThinning=1;' | ${tools_dir}/codes_bufr_filter - $f > ${f}.log 2>&1
+status=$?
+set -e
+[ $status -ne 0 ]
+grep -q "Invalid grid box thinning parameters" ${f}.log
+
+rm -f ${f}.log $fBufrTmp1 $fLog $fRules
+#-----------------------------------------------------------
 # Test: subset extraction constant values
 #-----------------------------------------------------------
 cat > $fRules <<EOF
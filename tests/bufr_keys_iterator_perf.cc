@@ -0,0 +1,93 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+/* Throughput of a full iteration over the keys of each BUFR message,
+ * with the keys iterator and the data section keys iterator */
+
+#include "grib_api_internal.h"
+
+#if ECCODES_TIMER
+
+static void usage(const char* prog)
+{
+    printf("usage: %s file repetitions\n", prog);
+    exit(1);
+}
+
+static size_t iterate(bufr_keys_iterator* kiter)
+{
+    size_t n = 0;
+    while (codes_bufr_keys_iterator_next(kiter)) {
+        const char* name = codes_bufr_keys_iterator_get_name(kiter);
+        Assert(name);
+        n++;
+    }
+    return n;
+}
+
+int main(int argc, char* argv[])
+{
+    grib_context* c = grib_context_get_default();
+    grib_timer* t1  = grib_get_timer(0, "keys iterator", 0, 1);
+    grib_timer* t2  = grib_get_timer(0, "data section keys iterator", 0, 1);
+    size_t nkeys = 0, ndata = 0;
+    int repeat, r, err = 0;
+    grib_handle* h = NULL;
+    FILE* in       = NULL;
+
+    if (argc != 3) usage(argv[0]);
+
+    in = fopen(argv[1], "rb");
+    if (!in) {
+        perror(argv[1]);
+        exit(1);
+    }
+    repeat = atoi(argv[2]);
+
+    while ((h = codes_handle_new_from_file(c, in, PRODUCT_BUFR, &err)) != NULL) {
+        GRIB_CHECK(grib_set_long(h, "unpack", 1), 0);
+
+        for (r = 0; r < repeat; r++) {
+            bufr_keys_iterator* kiter = NULL;
+
+            grib_timer_start(t1);
+            kiter = codes_bufr_keys_iterator_new(h, 0);
+            nkeys += iterate(kiter);
+            codes_bufr_keys_iterator_delete(kiter);
+            grib_timer_stop(t1, 0);
+
+            grib_timer_start(t2);
+            kiter = codes_bufr_data_section_keys_iterator_new(h);
+            ndata += iterate(kiter);
+            codes_bufr_keys_iterator_delete(kiter);
+            grib_timer_stop(t2, 0);
+        }
+        grib_handle_delete(h);
+    }
+    fclose(in);
+    GRIB_CHECK(err, 0);
+    if (nkeys == 0) {
+        printf("%s: no keys found\n", argv[1]);
+        exit(1);
+    }
+
+    printf("%s: %zu keys, %zu data section keys\n", argv[1], nkeys, ndata);
+    printf("  keys iterator               %8.2f Mkeys/s\n", nkeys / grib_timer_value(t1) / 1e6);
+    printf("  data section keys iterator  %8.2f Mkeys/s\n", ndata / grib_timer_value(t2) / 1e6);
+    return 0;
+}
+#else
+
+int main(int argc, char* argv[])
+{
+    return 0;
+}
+
+#endif
@@ -0,0 +1,63 @@
+#!/bin/sh
+# (C) Copyright 2005- ECMWF.
+#
+# This software is licensed under the terms of the Apache Licence Version 2.0
+# which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+# virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+#
+
+. ./include.ctest.sh
+
+label="filter_expressions_test"
+tempFilt=temp.$label.filt
+tempOut=temp.$label.txt
+tempRef=temp.$label.ref
+
+# Constant sub-expressions are folded when the rules are parsed.
+# The results must be the same as when they are evaluated for each message
+cat > $tempFilt <<EOF
+  transient a = 24 * 3600;
+  transient b = 7 / 2;
+  transient c = 7.0 / 2;
+  transient d = -(3 + 4);
+  transient e = 10 % 3;
+  transient f = 2 ^ 10;
+  transient g = 0 && nosuchkey > 1;
+  transient h = 1 || nosuchkey > 1;
+  transient i = 1 && edition == 2;
+  transient j = !(2 > 1);
+  print "[a] [b] [c] [d] [e] [f] [g] [h] [i] [j]";
+  set Ni = 7 / 2 * 2;
+  print "Ni=[Ni]";
+  if (3 > 2 && (1 == 1)) { print "true"; }
+  if (1 - 1) { print "wrong"; } else { print "false"; }
+  switch (2 * 2) {
+    case 4: print "four";
+    default: print "other";
+  }
+EOF
+
+${tools_dir}/grib_filter $tempFilt $ECCODES_SAMPLES_PATH/GRIB2.tmpl > $tempOut
+
+cat > $tempRef <<EOF
+86400 3 3.5 -7 1 1024 0 1 1 0
+Ni=6
+true
+false
+four
+EOF
+diff $tempRef $tempOut
+
+# Computed keys
+cat > $tempFilt <<EOF
+  if (edition == 2 && typeOfLevel is "surface" && centre is "ecmf" && step == 0) {
+    print "[edition] [typeOfLevel] [centre] [step]";
+  }
+EOF
+${tools_dir}/grib_filter $tempFilt $ECCODES_SAMPLES_PATH/GRIB2.tmpl > $tempOut
+grep -q "2 surface ecmf 0" $tempOut
+
+# Clean up
+rm -f $tempFilt $tempOut $tempRef
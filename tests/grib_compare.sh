@@ -281,6 +281,24 @@ set -e
 [ $status -eq 1 ]
 
 
+# ----------------------------------------
+# Count of different values and first element with the largest difference
+# ----------------------------------------
+echo 'set Ni=3; set Nj=2; set values = { 1, 2, 3, 4, 5, 6 }; write;' | ${tools_dir}/grib_filter -o $temp1 - $sample_g2
+echo 'set Ni=3; set Nj=2; set values = { 1, 2.5, 3, 4.5, 5, 6 }; write;' | ${tools_dir}/grib_filter -o $temp2 - $sample_g2
+for opt in "" "-R all=0.1"; do
+  set +e
+  ${tools_dir}/grib_compare $opt $temp1 $temp2 > $outfile
+  status=$?
+  set -e
+  [ $status -eq 1 ]
+  grep -q "2 out of 6 different" $outfile
+  grep -q "max diff. element 1:" $outfile
+done
+${tools_dir}/grib_compare -A 0.5 $temp1 $temp2
+${tools_dir}/grib_compare $temp1 $temp1
+
+
 # Failing cases
 # -----------------
 set +e
@@ -27,23 +27,27 @@ int main(int argc, char** argv)
     char date[10] = {0,};
     size_t lenDate  = 10, lenParam = 20, lenLevel = 50;
     char* order_by  = NULL;
+    char* where     = NULL;
 
-    if (argc != 3) return 1; //Usage: prog order_by grib_file grib_file ...
+    if (argc != 3 && argc != 4) return 1; //Usage: prog order_by [where] grib_file
 
     nkeys    = sizeof(keys) / sizeof(*keys);
     order_by = argv[1];
+    if (argc == 4) where = argv[2];
 
-    nfiles    = argc - 2;
+    nfiles    = 1;
     filenames = (const char**)malloc(sizeof(char*) * nfiles);
     for (i = 0; i < nfiles; i++)
-        filenames[i] = (char*)strdup(argv[i + 2]);
+        filenames[i] = (char*)strdup(argv[argc - 1]);
 
     set = grib_fieldset_new_from_files(0, filenames, nfiles, keys, nkeys, 0, 0, &err);
     GRIB_CHECK(err, 0);
 
-    /* not yet implemented */
-    /* err=grib_fieldset_apply_where(set,"(centre=='ecmf') && number==1 || step==6 "); */
-    /* GRIB_CHECK(err,0); */
+    if (where) {
+        err = grib_fieldset_apply_where(set, where);
+        GRIB_CHECK(err, 0);
+        printf("Where %s\n", where);
+    }
 
     grib_fieldset_apply_order_by(set, order_by);
     GRIB_CHECK(err, 0);
@@ -44,5 +44,39 @@ step,date,levelType,levelType
 EOF
 diff $tempRef $temp
 
+# Where-clause
+$EXEC ${test_dir}/grib_fieldset 'step:i desc' 'step>=6 && step<24' $input_grb > $temp
+cat > $tempRef <<EOF
+Where step>=6 && step<24
+Ordering by step:i desc
+
+3 fields in the fieldset
+step,date,levelType,levelType
+18 20110225 sfc 151
+12 20110225 sfc 151
+6 20110225 sfc 151
+EOF
+diff $tempRef $temp
+
+$EXEC ${test_dir}/grib_fieldset 'step:i asc' "levelType=='sfc' && !(step>0 && 24>step) || paramId=='999'" $input_grb > $temp
+cat > $tempRef <<EOF
+Where levelType=='sfc' && !(step>0 && 24>step) || paramId=='999'
+Ordering by step:i asc
+
+2 fields in the fieldset
+step,date,levelType,levelType
+0 20110225 sfc 151
+24 20110225 sfc 151
+EOF
+diff $tempRef $temp
+
+# Type mismatch between key and value
+set +e
+$EXEC ${test_dir}/grib_fieldset 'step:i asc' "step=='abc'" $input_grb > $temp 2>&1
+status=$?
+set -e
+[ $status -ne 0 ]
+grep -q "cannot compare" $temp
+
 # Clean up
 rm -f $temp $tempRef
@@ -0,0 +1,100 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+/* Throughput of handle creation and deletion, i.e. of parsing the
+ * definitions and allocating accessors, sections and dependencies */
+
+#include "grib_api_internal.h"
+
+#if ECCODES_TIMER
+
+static void usage(const char* prog)
+{
+    printf("usage: %s [-u] file repetitions\n", prog);
+    printf("    -u  unpack BUFR data section\n");
+    exit(1);
+}
+
+int main(int argc, char* argv[])
+{
+    grib_context* c  = grib_context_get_default();
+    grib_timer* tc   = grib_get_timer(0, "create+delete", 0, 1);
+    void** messages  = NULL;
+    size_t* lengths  = NULL;
+    size_t count     = 0, size = 0, i;
+    int repeat, r, err = 0, unpack = 0, iarg = 1;
+    grib_handle* h   = NULL;
+    FILE* in         = NULL;
+
+    if (argc > 1 && !strcmp(argv[1], "-u")) {
+        unpack = 1;
+        iarg++;
+    }
+    if (argc != iarg + 2) usage(argv[0]);
+
+    in = fopen(argv[iarg], "rb");
+    if (!in) {
+        perror(argv[iarg]);
+        exit(1);
+    }
+    repeat = atoi(argv[iarg + 1]);
+
+    /* Keep the messages in memory so that only decoding is timed */
+    while ((h = codes_handle_new_from_file(c, in, PRODUCT_ANY, &err)) != NULL) {
+        const void* msg = NULL;
+        size_t len      = 0;
+        GRIB_CHECK(grib_get_message(h, &msg, &len), 0);
+        if (count == size) {
+            size     = size ? 2 * size : 16;
+            messages = (void**)realloc(messages, size * sizeof(void*));
+            lengths  = (size_t*)realloc(lengths, size * sizeof(size_t));
+        }
+        messages[count] = malloc(len);
+        memcpy(messages[count], msg, len);
+        lengths[count] = len;
+        count++;
+        grib_handle_delete(h);
+    }
+    fclose(in);
+    GRIB_CHECK(err, 0);
+    if (count == 0) {
+        printf("%s: no messages found\n", argv[iarg]);
+        exit(1);
+    }
+
+    grib_timer_start(tc);
+    for (r = 0; r < repeat; r++) {
+        for (i = 0; i < count; i++) {
+            h = grib_handle_new_from_message(c, messages[i], lengths[i]);
+            Assert(h);
+            if (unpack)
+                GRIB_CHECK(grib_set_long(h, "unpack", 1), 0);
+            grib_handle_delete(h);
+        }
+    }
+    grib_timer_stop(tc, 0);
+
+    printf("%s: %zu messages x %d: %g ms per handle, %g handles/s\n", argv[iarg], count, repeat,
+           grib_timer_value(tc) * 1000 / (count * repeat), (count * repeat) / grib_timer_value(tc));
+
+    for (i = 0; i < count; i++)
+        free(messages[i]);
+    free(messages);
+    free(lengths);
+    return 0;
+}
+#else
+
+int main(int argc, char* argv[])
+{
+    return 0;
+}
+
+#endif
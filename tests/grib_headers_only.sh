@@ -18,16 +18,28 @@ rm -f $tempText $tempLog
 sample_g1="$ECCODES_SAMPLES_PATH/GRIB1.tmpl"
 sample_g2="$ECCODES_SAMPLES_PATH/GRIB2.tmpl"
 
-files="$sample_g1 $sample_g2"
-for f in $files; do
-  # Since we're not including the data section, the packingType key must not appear
-  ${tools_dir}/grib_ls -j -M -x $f > $tempLog
-  set +e
-  grep -q "packingType" $tempLog
-  status=$?
-  set -e
-  [ $status -ne 0 ]
-done
+# Since we're not including the data section, the packingType key must not appear
+${tools_dir}/grib_ls -j -M -x $sample_g1 > $tempLog
+set +e
+grep -q "packingType" $tempLog
+status=$?
+set -e
+[ $status -ne 0 ]
+
+# GRIB2 headers-only also reads section 5 (packing) but not the bitmap and data
+${tools_dir}/grib_ls -j -M -x $sample_g2 > $tempLog
+grep -q "packingType" $tempLog
+${tools_dir}/grib_ls -M -x -p packingType,section6Length,values $sample_g2 > $tempLog
+grep -q "grid_simple *not_found *not_found" $tempLog
+
+# Headers-only reads must skip to the following messages
+tempGrib=temp.$label.grib
+${tools_dir}/grib_set -s bitsPerValue=12,level=850 $sample_g2 $tempGrib
+cat $sample_g2 $tempGrib $sample_g1 $tempGrib > $tempText
+${tools_dir}/grib_ls -M -p edition,level,offset,totalLength $tempText > $tempLog
+${tools_dir}/grib_ls -M -x -p edition,level,offset,totalLength $tempText > $tempGrib
+diff $tempLog $tempGrib
+rm -f $tempGrib
 
 ${tools_dir}/grib_dump -M -x -O $sample_g1 > $tempLog
 ${tools_dir}/grib_dump -M -x -O $sample_g2 > $tempLog
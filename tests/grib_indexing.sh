@@ -150,6 +150,11 @@ cp ${data_dir}/tigge/tigge_rjtd_sfc_*grib $temp_dir_B
 ${tools_dir}/grib_index_build -o $tempIndex1 $temp_dir_A > /dev/null
 ${tools_dir}/grib_dump $tempIndex1 > /dev/null
 
+# Read messages from many files while the file pool has to evict open ones
+cp $tempIndex1 $tempIndex2
+ECCODES_FILE_POOL_MAX_OPENED_FILES=2 ${tools_dir}/grib_compare $tempIndex1 $tempIndex2
+rm -f $tempIndex2
+
 rm -rf $temp_dir_A
 
 
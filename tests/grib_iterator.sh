@@ -13,6 +13,8 @@
 label="grib_iterator_test"
 tempText=temp.$label.txt
 tempGrib=temp.$label.grib
+tempRef=temp.$label.ref
+tempFilt=temp.$label.filt
 
 files="reduced_latlon_surface.grib1 \
       reduced_gaussian_pressure_level.grib1 \
@@ -150,5 +152,51 @@ ECCODES_DEBUG=1 ${tools_dir}/grib_get_data $input > $tempText 2>&1
 grep "global num points=6114" $tempText
 
 
+# Binary columns: the coordinates are only written when the grid changes
+# -----------------------------------------------------------------------
+input=$ECCODES_SAMPLES_PATH/regular_ll_sfc_grib2.tmpl
+cat $input $input $samp_dir/sh_ml_grib2.tmpl > $tempGrib
+${tools_dir}/grib_get_data -o $label $tempGrib > $tempText
+cat > $tempRef <<EOF
+LatLonOffset ValuesOffset NumberOfPoints
+0 0 496
+0 496 496
+-1 992 4160
+EOF
+diff $tempRef $tempText
+[ `wc -c < $label.lat` -eq 3968 ]
+[ `wc -c < $label.lon` -eq 3968 ]
+[ `wc -c < $label.values` -eq 41216 ]
+
+${tools_dir}/grib_get_data -o $label -E float $tempGrib > $tempText
+diff $tempRef $tempText
+[ `wc -c < $label.lat` -eq 1984 ]
+[ `wc -c < $label.values` -eq 20608 ]
+
+# Not +i+j: the iterator reorders the values, the second message must match the first
+echo "set bitsPerValue = 16; set values = { `seq -s, 1 496` }; write;" > $tempFilt
+${tools_dir}/grib_filter -o $tempGrib $tempFilt $samp_dir/polar_stereographic_sfc_grib2.tmpl
+scanningMode=`${tools_dir}/grib_get -p scanningMode $tempGrib`
+[ "$scanningMode" = "0" ]
+cat $tempGrib $tempGrib > $tempGrib.2
+${tools_dir}/grib_get_data -o $label $tempGrib.2 > $tempText
+cat > $tempRef <<EOF
+LatLonOffset ValuesOffset NumberOfPoints
+0 0 496
+0 496 496
+EOF
+diff $tempRef $tempText
+cmp -n 3968 $label.values $label.values 0 3968
+rm -f $tempGrib.2
+
+set +e
+${tools_dir}/grib_get_data -o $label -E half $input > $tempText 2>&1
+status=$?
+set -e
+[ $status -ne 0 ]
+grep -q "Invalid type" $tempText
+rm -f $label.lat $label.lon $label.values
+
+
 # Clean up
-rm -f $tempText $tempGrib
+rm -f $tempText $tempGrib $tempRef $tempFilt
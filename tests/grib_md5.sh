@@ -12,6 +12,8 @@
 
 label="grib_md5_test"
 temp=temp.$label.grib
+tempText=temp.$label.txt
+tempRef=temp.$label.ref
 
 test_md5()
 {
@@ -42,5 +44,28 @@ md1=`${tools_dir}/grib_get -p md5GridSection:s $input`
 md2=`${tools_dir}/grib_get -p md5GridSection:s $temp`
 [ "$md1" != "$md2" ]
 
+# Fast fingerprints: xxh3 and crc32c keys
+# ------------------------------------------------
+input=$ECCODES_SAMPLES_PATH/GRIB2.tmpl
+result=`${tools_dir}/grib_get -p xxh3DataSection,crc32cDataSection $input`
+[ "$result" = "014915f730ff58fe cc90eb75" ]
+xx1=`${tools_dir}/grib_get -p xxh3GridSection $input`
+xx2=`${tools_dir}/grib_get -p xxh3GridSection $temp`
+[ "$xx1" != "$xx2" ]
+result=`${tools_dir}/grib_get -p xxh3Headers,crc32cHeaders $ECCODES_SAMPLES_PATH/GRIB1.tmpl`
+[ "$result" = "7f6b0050170b4e64 f28cbc9b" ]
+
+# Fingerprints of whole messages from the count tool
+cat $input $ECCODES_SAMPLES_PATH/GRIB1.tmpl $input > $temp
+${tools_dir}/grib_count -H xxh3 $temp > $tempText
+cat > $tempRef <<EOF
+560c86510e86e312 0 179 $temp
+083a0a96ff77ff98 179 107 $temp
+560c86510e86e312 286 179 $temp
+EOF
+diff $tempRef $tempText
+result=`${tools_dir}/grib_count -H crc32c $temp | cut -d' ' -f1 | tr '\n' ' '`
+[ "$result" = "5b79e02a 5141fb7b 5b79e02a " ]
+
 # Clean up
-rm -f $temp
+rm -f $temp $tempText $tempRef
@@ -44,7 +44,15 @@ c2=$(${tools_dir}/grib_count $tmpdata)
 [ $c1 -eq 30 ]
 [ $c2 -eq 56 ]
 
+# Single-field messages are used as they are in multi-field mode
+# --------------------------------------------------------------
+cat $ECCODES_SAMPLES_PATH/GRIB2.tmpl $ECCODES_SAMPLES_PATH/regular_ll_sfc_grib2.tmpl > $tmpdata.2
+${tools_dir}/grib_copy $tmpdata.2 $tmpdata
+cmp $tmpdata.2 $tmpdata
+${tools_dir}/grib_copy -M $tmpdata.2 $tmpdata
+cmp $tmpdata.2 $tmpdata
+
 
 # Clean up
 rm -f $tmpdata
-rm -f $tmpdata.1 $tmpdata.rules
+rm -f $tmpdata.1 $tmpdata.2 $tmpdata.rules
@@ -0,0 +1,150 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+/* Throughput of the text output of grib_get_data and grib_dump -j,
+ * with fprintf and with the grib_output_buffer */
+
+#include "grib_api_internal.h"
+
+#if ECCODES_TIMER
+
+static void usage(const char* prog)
+{
+    printf("usage: %s file repetitions\n", prog);
+    exit(1);
+}
+
+/* As grib_get_data with the default formats */
+static void get_data_fprintf(FILE* out, const double* lats, const double* lons, const double* values, size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++) {
+        fprintf(out, "%9.3f%9.3f ", lats[i], lons[i]);
+        fprintf(out, "%.10e", values[i]);
+        fprintf(out, "\n");
+    }
+}
+
+static void get_data_buffer(FILE* out, const double* lats, const double* lons, const double* values, size_t n)
+{
+    static grib_output_buffer b;
+    size_t i;
+    grib_output_buffer_init(&b, out);
+    for (i = 0; i < n; i++) {
+        const double latlon[2] = { lats[i], lons[i] };
+        grib_output_buffer_printf(&b, "%9.3f%9.3f ", latlon, 2);
+        grib_output_buffer_double(&b, "%.10e", values[i]);
+        grib_output_buffer_write(&b, "\n", 1);
+    }
+    grib_output_buffer_flush(&b);
+}
+
+/* As the values array of grib_dump -j */
+static void json_fprintf(FILE* out, const double* values, size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++) {
+        if (i % 10 == 0)
+            fprintf(out, "\n%-*s", 4, " ");
+        fprintf(out, "%g, ", values[i]);
+    }
+}
+
+static void json_buffer(FILE* out, const double* values, size_t n)
+{
+    static grib_output_buffer b;
+    size_t i;
+    grib_output_buffer_init(&b, out);
+    for (i = 0; i < n; i++) {
+        if (i % 10 == 0) {
+            grib_output_buffer_write(&b, "\n", 1);
+            grib_output_buffer_indent(&b, 4);
+        }
+        grib_output_buffer_double(&b, "%g, ", values[i]);
+    }
+    grib_output_buffer_flush(&b);
+}
+
+int main(int argc, char* argv[])
+{
+    grib_context* c = grib_context_get_default();
+    grib_timer* t1  = grib_get_timer(0, "get_data fprintf", 0, 1);
+    grib_timer* t2  = grib_get_timer(0, "get_data buffer", 0, 1);
+    grib_timer* t3  = grib_get_timer(0, "json fprintf", 0, 1);
+    grib_timer* t4  = grib_get_timer(0, "json buffer", 0, 1);
+    double *lats = NULL, *lons = NULL, *values = NULL;
+    size_t n = 0, total = 0;
+    int repeat, r, err = 0;
+    grib_handle* h = NULL;
+    FILE *in = NULL, *out = NULL;
+
+    if (argc != 3) usage(argv[0]);
+
+    in = fopen(argv[1], "rb");
+    if (!in) {
+        perror(argv[1]);
+        exit(1);
+    }
+    out = fopen("/dev/null", "w");
+    Assert(out);
+    repeat = atoi(argv[2]);
+
+    while ((h = grib_handle_new_from_file(c, in, &err)) != NULL) {
+        GRIB_CHECK(grib_get_size(h, "values", &n), 0);
+        lats   = (double*)malloc(n * sizeof(double));
+        lons   = (double*)malloc(n * sizeof(double));
+        values = (double*)malloc(n * sizeof(double));
+        Assert(lats && lons && values);
+        GRIB_CHECK(grib_get_data(h, lats, lons, values), 0);
+
+        for (r = 0; r < repeat; r++) {
+            grib_timer_start(t1);
+            get_data_fprintf(out, lats, lons, values, n);
+            grib_timer_stop(t1, 0);
+            grib_timer_start(t2);
+            get_data_buffer(out, lats, lons, values, n);
+            grib_timer_stop(t2, 0);
+            grib_timer_start(t3);
+            json_fprintf(out, values, n);
+            grib_timer_stop(t3, 0);
+            grib_timer_start(t4);
+            json_buffer(out, values, n);
+            grib_timer_stop(t4, 0);
+        }
+        total += n * repeat;
+
+        free(lats);
+        free(lons);
+        free(values);
+        grib_handle_delete(h);
+    }
+    fclose(in);
+    fclose(out);
+    GRIB_CHECK(err, 0);
+    if (total == 0) {
+        printf("%s: no values found\n", argv[1]);
+        exit(1);
+    }
+
+    printf("%s: %zu values\n", argv[1], total);
+    printf("  grib_get_data  fprintf %8.2f Mvalues/s  buffer %8.2f Mvalues/s\n",
+           total / grib_timer_value(t1) / 1e6, total / grib_timer_value(t2) / 1e6);
+    printf("  grib_dump -j   fprintf %8.2f Mvalues/s  buffer %8.2f Mvalues/s\n",
+           total / grib_timer_value(t3) / 1e6, total / grib_timer_value(t4) / 1e6);
+    return 0;
+}
+#else
+
+int main(int argc, char* argv[])
+{
+    return 0;
+}
+
+#endif
@@ -95,6 +95,17 @@ status=$?
 set -e
 [ $status -ne 0 ]
 
+# Same check when the output name is a template which only matches the second input file
+input2=${data_dir}/temp.$label.2
+cp $ECCODES_SAMPLES_PATH/GRIB2.tmpl $input2
+set +e
+${tools_dir}/grib_set -s centre=98 $ECCODES_SAMPLES_PATH/GRIB1.tmpl $input2 ${data_dir}/temp.$label.[edition] 2>$temp
+status=$?
+set -e
+[ $status -ne 0 ]
+grep -q "same as input" $temp
+rm -f $input2 ${data_dir}/temp.$label.1
+
 # ECC-1777: Bad date/time
 # -------------------------
 input=$ECCODES_SAMPLES_PATH/GRIB2.tmpl
@@ -0,0 +1,118 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "eccodes.h"
+#undef NDEBUG
+#include <assert.h>
+
+/*
+ * Apply the same keys with sequential sets and inside a set transaction.
+ * The resulting messages must be identical.
+ */
+typedef struct set_key
+{
+    const char* name;
+    int type;
+    long lval;
+    double dval;
+    const char* sval;
+} set_key;
+
+static const set_key keys[] = {
+    { "productDefinitionTemplateNumber", CODES_TYPE_LONG, 11, 0, NULL },
+    { "typeOfStatisticalProcessing", CODES_TYPE_LONG, 1, 0, NULL },
+    { "perturbationNumber", CODES_TYPE_LONG, 3, 0, NULL },
+    { "numberOfForecastsInEnsemble", CODES_TYPE_LONG, 51, 0, NULL },
+    { "stepRange", CODES_TYPE_STRING, 0, 0, "6-12" },
+    { "gridType", CODES_TYPE_STRING, 0, 0, "rotated_ll" },
+    { "latitudeOfSouthernPoleInDegrees", CODES_TYPE_DOUBLE, 0, -30, NULL },
+    { "angleOfRotationInDegrees", CODES_TYPE_DOUBLE, 0, 10, NULL },
+    { "centre", CODES_TYPE_STRING, 0, 0, "lfpw" },
+    { "shortName", CODES_TYPE_STRING, 0, 0, "2t" },
+    { "scaleFactorOfFirstFixedSurface", CODES_TYPE_MISSING, 0, 0, NULL },
+};
+static const size_t num_keys = sizeof(keys) / sizeof(keys[0]);
+
+static void set_keys(codes_handle* h)
+{
+    size_t i = 0;
+    for (i = 0; i < num_keys; i++) {
+        size_t len = 0;
+        switch (keys[i].type) {
+            case CODES_TYPE_LONG:
+                CODES_CHECK(codes_set_long(h, keys[i].name, keys[i].lval), keys[i].name);
+                break;
+            case CODES_TYPE_DOUBLE:
+                CODES_CHECK(codes_set_double(h, keys[i].name, keys[i].dval), keys[i].name);
+                break;
+            case CODES_TYPE_STRING:
+                len = strlen(keys[i].sval);
+                CODES_CHECK(codes_set_string(h, keys[i].name, keys[i].sval, &len), keys[i].name);
+                break;
+            default:
+                CODES_CHECK(codes_set_missing(h, keys[i].name), keys[i].name);
+                break;
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const char* sample = argc > 1 ? argv[1] : "GRIB2";
+    const void *m1 = NULL, *m2 = NULL;
+    size_t len1 = 0, len2 = 0;
+    long pdtn = 0, number = 0;
+    double values[4] = { 1, 2, 3, 4 };
+
+    codes_handle* h1 = codes_grib_handle_new_from_samples(NULL, sample);
+    codes_handle* h2 = codes_grib_handle_new_from_samples(NULL, sample);
+    assert(h1 && h2);
+
+    set_keys(h1);
+
+    CODES_CHECK(codes_set_begin(h2), 0);
+    assert(codes_set_begin(h2) == CODES_INVALID_ARGUMENT);
+    CODES_CHECK(codes_set_long(h2, "perturbationNumber", 99), 0); /* Overridden below */
+    set_keys(h2);
+    /* Nothing is applied before the commit */
+    CODES_CHECK(codes_get_long(h2, "productDefinitionTemplateNumber", &pdtn), 0);
+    assert(pdtn == 0);
+    CODES_CHECK(codes_set_commit(h2), 0);
+    assert(codes_set_commit(h2) == CODES_INVALID_ARGUMENT);
+
+    CODES_CHECK(codes_get_long(h2, "productDefinitionTemplateNumber", &pdtn), 0);
+    CODES_CHECK(codes_get_long(h2, "perturbationNumber", &number), 0);
+    assert(pdtn == 11 && number == 3);
+
+    CODES_CHECK(codes_get_message(h1, &m1, &len1), 0);
+    CODES_CHECK(codes_get_message(h2, &m2, &len2), 0);
+    printf("sequential=%zu bytes, transaction=%zu bytes\n", len1, len2);
+    assert(len1 == len2);
+    assert(memcmp(m1, m2, len1) == 0);
+
+    /* An array set applies what was recorded before it */
+    CODES_CHECK(codes_set_begin(h2), 0);
+    CODES_CHECK(codes_set_long(h2, "bitsPerValue", 16), 0);
+    CODES_CHECK(codes_set_long(h2, "Ni", 2), 0);
+    CODES_CHECK(codes_set_long(h2, "Nj", 2), 0);
+    CODES_CHECK(codes_set_double_array(h2, "values", values, 4), 0);
+    CODES_CHECK(codes_set_long(h2, "perturbationNumber", 4), 0);
+    CODES_CHECK(codes_set_commit(h2), 0);
+    CODES_CHECK(codes_get_long(h2, "perturbationNumber", &number), 0);
+    assert(number == 4);
+    CODES_CHECK(codes_get_long(h2, "numberOfValues", &number), 0);
+    assert(number == 4);
+
+    codes_handle_delete(h1);
+    codes_handle_delete(h2);
+    return 0;
+}
@@ -0,0 +1,17 @@
+#!/bin/sh
+# (C) Copyright 2005- ECMWF.
+#
+# This software is licensed under the terms of the Apache Licence Version 2.0
+# which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+# virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+#
+
+. ./include.ctest.sh
+
+label="grib_set_transaction_test"
+
+# Sets inside a transaction must give the same message as sequential sets
+${test_dir}/grib_set_transaction GRIB2
+${test_dir}/grib_set_transaction regular_ll_sfc_grib2
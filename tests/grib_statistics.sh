@@ -13,6 +13,7 @@
 label="grib_statistics_test"
 temp1=temp1.$label.grib
 temp2=temp2.$label.grib
+tempFilt=temp.$label.filt
 
 files="regular_latlon_surface.grib2 regular_latlon_surface.grib1"
 
@@ -62,4 +63,24 @@ input=${data_dir}/gfs.complex.mvmu.grib2
 stats=`${tools_dir}/grib_get -F%.2f -p max,min,avg $input`
 [ "$stats" = "2.81 0.00 0.30" ]
 
-rm -f $temp1 $temp2
+# Missing values are left out of all the statistics
+# ---------------------------------------------------
+input=$ECCODES_SAMPLES_PATH/regular_ll_sfc_grib2.tmpl
+cat >$tempFilt<<EOF
+ set bitmapPresent=1;
+ set Ni=5;
+ set Nj=1;
+ set values={9999,3,9999,4,5};
+ write;
+EOF
+${tools_dir}/grib_filter -o $temp1 $tempFilt $input
+stats=`${tools_dir}/grib_get -F%.6f -p max,min,avg,numberOfMissing,sd,skew,kurt,const $temp1`
+[ "$stats" = "5.000000 3.000000 4.000000 2 0.816497 0.000000 -1.500000 0.000000" ]
+
+# Constant field with more values than a block of the reduction
+input=$ECCODES_SAMPLES_PATH/reduced_gg_pl_96_grib2.tmpl
+${tools_dir}/grib_set -d 2.5 $input $temp1
+stats=`${tools_dir}/grib_get -p max,min,avg,sd,const $temp1`
+[ "$stats" = "2.5 2.5 2.5 0 1" ]
+
+rm -f $temp1 $temp2 $tempFilt
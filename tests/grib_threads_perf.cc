@@ -0,0 +1,137 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+/* Decoding throughput from 1, 2, 4, ... threads sharing the default context,
+ * to show how well the definition, codetable and concept caches scale */
+
+#include <pthread.h>
+#include <unistd.h>
+
+#include "grib_api_internal.h"
+
+#if ECCODES_TIMER && GRIB_PTHREADS
+
+static void** messages = NULL;
+static size_t* lengths = NULL;
+static size_t count    = 0;
+static int repeat      = 0;
+
+static const char* keys[] = { "shortName", "typeOfLevel", "level", "stepRange", "gridType", "paramId" };
+
+static void* decode(void* arg)
+{
+    grib_context* c = grib_context_get_default();
+    char value[256];
+    size_t i, k, len;
+    int r;
+
+    for (r = 0; r < repeat; r++) {
+        for (i = 0; i < count; i++) {
+            grib_handle* h = grib_handle_new_from_message(c, messages[i], lengths[i]);
+            Assert(h);
+            for (k = 0; k < sizeof(keys) / sizeof(keys[0]); k++) {
+                len = sizeof(value);
+                grib_get_string(h, keys[k], value, &len);
+            }
+            grib_handle_delete(h);
+        }
+    }
+    return NULL;
+}
+
+static void usage(const char* prog)
+{
+    printf("usage: %s file repetitions [max_threads]\n", prog);
+    exit(1);
+}
+
+int main(int argc, char* argv[])
+{
+    grib_context* c  = grib_context_get_default();
+    grib_timer* tc   = grib_get_timer(0, "threads", 0, 1);
+    long ncores      = sysconf(_SC_NPROCESSORS_ONLN);
+    int max_threads  = 0, nthreads, t, err = 0;
+    size_t size      = 0, i;
+    double base      = 0;
+    pthread_t* tids  = NULL;
+    grib_handle* h   = NULL;
+    FILE* in         = NULL;
+
+    if (argc < 3 || argc > 4) usage(argv[0]);
+    repeat      = atoi(argv[2]);
+    max_threads = argc == 4 ? atoi(argv[3]) : 2 * (int)ncores;
+    if (repeat < 1 || max_threads < 1) usage(argv[0]);
+
+    in = fopen(argv[1], "rb");
+    if (!in) {
+        perror(argv[1]);
+        exit(1);
+    }
+
+    /* Keep the messages in memory so that only decoding is timed */
+    while ((h = grib_handle_new_from_file(c, in, &err)) != NULL) {
+        const void* msg = NULL;
+        size_t len      = 0;
+        GRIB_CHECK(grib_get_message(h, &msg, &len), 0);
+        if (count == size) {
+            size     = size ? 2 * size : 16;
+            messages = (void**)realloc(messages, size * sizeof(void*));
+            lengths  = (size_t*)realloc(lengths, size * sizeof(size_t));
+        }
+        messages[count] = malloc(len);
+        memcpy(messages[count], msg, len);
+        lengths[count] = len;
+        count++;
+        grib_handle_delete(h);
+    }
+    fclose(in);
+    GRIB_CHECK(err, 0);
+    if (count == 0) {
+        printf("%s: no messages found\n", argv[1]);
+        exit(1);
+    }
+
+    /* Warm the caches once so that every run measures the steady state */
+    repeat = 1;
+    decode(NULL);
+    repeat = atoi(argv[2]);
+
+    tids = (pthread_t*)malloc(max_threads * sizeof(pthread_t));
+    printf("%s: %zu messages x %d per thread, %ld cores\n", argv[1], count, repeat, ncores);
+    for (nthreads = 1; nthreads <= max_threads; nthreads *= 2) {
+        double rate, start = grib_timer_value(tc);
+        grib_timer_start(tc);
+        for (t = 0; t < nthreads; t++)
+            pthread_create(&tids[t], NULL, decode, NULL);
+        for (t = 0; t < nthreads; t++)
+            pthread_join(tids[t], NULL);
+        grib_timer_stop(tc, 0);
+
+        rate = (double)(count * repeat * nthreads) / (grib_timer_value(tc) - start);
+        if (nthreads == 1) base = rate;
+        printf("%3d threads: %10.1f handles/s, speedup %5.2f (ideal %ld)\n", nthreads, rate, rate / base,
+               nthreads < ncores ? (long)nthreads : ncores);
+    }
+
+    free(tids);
+    for (i = 0; i < count; i++)
+        free(messages[i]);
+    free(messages);
+    free(lengths);
+    return 0;
+}
+#else
+
+int main(int argc, char* argv[])
+{
+    return 0;
+}
+
+#endif
@@ -102,6 +102,19 @@ if [ $have_netcdf4 -eq 1 ]; then
     ${tools_dir}/grib_to_netcdf -s -d9 -k4 -o $tempNetcdf $input
 fi
 
+echo "Test chunking along the time axis ..."
+# ---------------------------------------
+if [ $have_netcdf4 -eq 1 ]; then
+    input=${data_dir}/sample.grib2
+    ${tools_dir}/grib_to_netcdf -C 4 -d6 -k3 -o $tempNetcdf $input
+    set +e
+    ${tools_dir}/grib_to_netcdf -C 4 -k3 -o $tempNetcdf $input 2>$tempText
+    status=$?
+    set -e
+    [ $status -ne 0 ]
+    grep -q "Deflate option needed" $tempText
+fi
+
 echo "Test ECC-1060 ..."
 # ----------------------
 sample2=$ECCODES_SAMPLES_PATH/GRIB2.tmpl
@@ -0,0 +1,70 @@
+#!/bin/sh
+# (C) Copyright 2005- ECMWF.
+#
+# This software is licensed under the terms of the Apache Licence Version 2.0
+# which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+# virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+#
+
+. ./include.ctest.sh
+
+label="grib_tools_threads_test"
+tempGrib=temp.$label.grib
+tempFilt=temp.$label.filt
+tempOut=temp.$label.out
+tempRef=temp.$label.ref
+
+# Processing on several threads (-j) must give the same output, in the same order, as a single thread
+rm -f $tempGrib
+for step in 0 6 12 18 24 30 36 42; do
+    for sample in GRIB1 GRIB2 regular_ll_pl_grib2; do
+        ${tools_dir}/grib_set -s step=$step $ECCODES_SAMPLES_PATH/$sample.tmpl $tempOut
+        cat $tempOut >> $tempGrib
+    done
+done
+
+# grib_set
+${tools_dir}/grib_set -r -s packingType=grid_simple,bitsPerValue=12 $tempGrib $tempRef
+${tools_dir}/grib_set -j 4 -r -s packingType=grid_simple,bitsPerValue=12 $tempGrib $tempOut
+cmp $tempRef $tempOut
+
+# grib_copy with a template in the output name and a where clause
+${tools_dir}/grib_copy -w edition=2 $tempGrib temp.$label.ref_[count].grib
+${tools_dir}/grib_copy -j 3 -w edition=2 $tempGrib temp.$label.out_[count].grib
+for f in temp.$label.ref_*.grib; do
+    cmp $f temp.$label.out_${f#temp.$label.ref_}
+done
+rm -f temp.$label.ref_*.grib temp.$label.out_*.grib
+
+# grib_copy with printing
+${tools_dir}/grib_copy -p count,edition,step -w count!=5 $tempGrib $tempRef > $tempFilt.ref
+${tools_dir}/grib_copy -j 2 -p count,edition,step -w count!=5 $tempGrib $tempOut > $tempFilt.out
+cmp $tempRef $tempOut
+diff $tempFilt.ref $tempFilt.out
+
+# grib_filter with prints and conditional writes
+cat > $tempFilt <<EOF2
+ print "[count] [edition] [step]";
+ if (step > 12) { write "$tempOut.[edition]"; }
+EOF2
+rm -f $tempOut.1 $tempOut.2 $tempRef.1 $tempRef.2
+${tools_dir}/grib_filter $tempFilt $tempGrib > $tempFilt.ref
+mv $tempOut.1 $tempRef.1
+mv $tempOut.2 $tempRef.2
+${tools_dir}/grib_filter -j 4 $tempFilt $tempGrib > $tempFilt.out
+diff $tempFilt.ref $tempFilt.out
+cmp $tempRef.1 $tempOut.1
+cmp $tempRef.2 $tempOut.2
+
+# Bad number of threads
+set +e
+${tools_dir}/grib_copy -j 0 $tempGrib $tempOut
+status=$?
+set -e
+[ $status -ne 0 ]
+
+# Clean up
+rm -f $tempGrib $tempFilt $tempFilt.ref $tempFilt.out $tempOut $tempRef
+rm -f $tempOut.1 $tempOut.2 $tempRef.1 $tempRef.2
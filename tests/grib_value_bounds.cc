@@ -0,0 +1,66 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+/* Check the bounds from codes_get_value_bounds() against the decoded values */
+#include "eccodes.h"
+#include <assert.h>
+
+int main(int argc, char** argv)
+{
+    assert(argc == 2);
+
+    int err = 0, count = 0;
+    const char* filename = argv[1];
+    codes_handle* h      = NULL;
+
+    FILE* fin = fopen(filename, "rb");
+    assert(fin);
+
+    while ((h = codes_handle_new_from_file(0, fin, PRODUCT_GRIB, &err)) != NULL) {
+        double lo = 0, hi = 0, missing = 0, min = 0, max = 0;
+        int exact = 0, n = 0;
+        size_t i = 0, len = 0;
+        double* values = NULL;
+
+        ++count;
+        err = codes_get_value_bounds(h, &lo, &hi, &exact);
+        if (err == CODES_NOT_IMPLEMENTED) {
+            printf("%s #%d: no bounds\n", filename, count);
+            codes_handle_delete(h);
+            continue;
+        }
+        CODES_CHECK(err, 0);
+        assert(lo <= hi);
+
+        CODES_CHECK(codes_get_double(h, "missingValue", &missing), 0);
+        CODES_CHECK(codes_get_size(h, "values", &len), 0);
+        values = (double*)malloc(len * sizeof(double));
+        assert(values);
+        CODES_CHECK(codes_get_double_array(h, "values", values, &len), 0);
+
+        for (i = 0; i < len; ++i) {
+            if (values[i] == missing) continue;
+            if (n == 0 || values[i] < min) min = values[i];
+            if (n == 0 || values[i] > max) max = values[i];
+            ++n;
+        }
+        printf("%s #%d: bounds=[%g, %g] exact=%d values=[%g, %g]\n", filename, count, lo, hi, exact, min, max);
+        if (n > 0) {
+            assert(lo <= min && max <= hi);
+            if (exact) assert(lo == min && hi == max);
+        }
+
+        free(values);
+        codes_handle_delete(h);
+    }
+
+    fclose(fin);
+    return err;
+}
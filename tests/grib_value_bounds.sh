@@ -0,0 +1,43 @@
+#!/bin/sh
+# (C) Copyright 2005- ECMWF.
+#
+# This software is licensed under the terms of the Apache Licence Version 2.0
+# which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+# virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+#
+
+. ./include.ctest.sh
+
+label="grib_value_bounds_test"
+tempOut=temp.$label.txt
+
+# Constant fields: the bounds are exact
+for f in constant_field.grib1 constant_field.grib2; do
+    $EXEC ${test_dir}/grib_value_bounds ${data_dir}/$f > $tempOut
+    grep -q "exact=1" $tempOut
+done
+
+# Grid simple, with and without bitmap, and JPEG
+gfiles="regular_latlon_surface.grib1 regular_latlon_surface.grib2 reduced_latlon_surface.grib2"
+gfiles="$gfiles simple_bitmap.grib missing.grib2 sst_globus0083.grib"
+if [ $HAVE_JPEG -eq 1 ]; then
+    gfiles="$gfiles jpeg.grib2"
+fi
+if [ $HAVE_AEC -eq 1 ]; then
+    gfiles="$gfiles ccsds.grib2"
+fi
+for f in $gfiles; do
+    $EXEC ${test_dir}/grib_value_bounds ${data_dir}/$f > $tempOut
+    grep -q "bounds=" $tempOut
+done
+
+# Spectral, grid complex and second order: no bounds from the packing parameters
+for f in spherical_pressure_level.grib2 gfs.complex.mvmu.grib2 second_ord_rbr.grib1; do
+    $EXEC ${test_dir}/grib_value_bounds ${data_dir}/$f > $tempOut
+    grep -q "no bounds" $tempOut
+done
+
+# Clean up
+rm -f $tempOut
@@ -10,6 +10,7 @@
 
 #include "grib_api_internal.h"
 #include "eccodes.h"
+#include <float.h>
 
 #define NUMBER(x) (sizeof(x) / sizeof(x[0]))
 
@@ -383,6 +384,39 @@ static void test_string_remove_char()
     Assert(STR_EQUAL(input, "abc"));
 }
 
+static void test_output_buffer_formats()
+{
+    printf("Running %s ...\n", __func__);
+
+    const char* formats[] = { "%g", "%g, ", "%.10e", "%9.3f%9.3f ", "%12.6f", "%-10.2g|", "%+e", "% f",
+                              "%010.3f", "%E", "%G", "%.0f", "%.0e", "%.0g", "%#g", "%lf", "%5.1F", "%%%g%%", "[%.17g]" };
+    const double values[] = { 0, -0.0, 1, -1, 0.1, 1e-5, 0.5, 2.5, 273.15, 123456.789, 999999.5, 1e15, 1e300,
+                              -1e-300, DBL_MAX, DBL_MIN, INFINITY, -INFINITY, NAN, -3.14159265358979 };
+    char expected[4096], actual[4096];
+
+    for (size_t i = 0; i < NUMBER(formats); ++i) {
+        for (size_t j = 0; j < NUMBER(values); ++j) {
+            const double pair[2] = { values[j], -values[j] };
+            FILE* f = tmpfile();
+            Assert(f);
+            grib_output_buffer b;
+            grib_output_buffer_init(&b, f);
+            grib_output_buffer_printf(&b, formats[i], pair, 2);
+            grib_output_buffer_flush(&b);
+            rewind(f);
+            size_t n = fread(actual, 1, sizeof(actual) - 1, f);
+            actual[n] = 0;
+            fclose(f);
+
+            snprintf(expected, sizeof(expected), formats[i], pair[0], pair[1]);
+            if (!STR_EQUAL(expected, actual)) {
+                fprintf(stderr, "format=\"%s\" expected=\"%s\" actual=\"%s\"\n", formats[i], expected, actual);
+                Assert(0);
+            }
+        }
+    }
+}
+
 static void test_gribex_mode()
 {
     grib_context* c = grib_context_get_default();
@@ -786,6 +820,7 @@ int main(int argc, char** argv)
     test_string_trimming();
     test_string_replace_char();
     test_string_remove_char();
+    test_output_buffer_formats();
 
     test_grib2_select_PDTN();
 
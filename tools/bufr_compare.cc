@@ -196,6 +196,47 @@ static double compare_double_relative(const double* a, const double* b, const do
     return relativeError > *err ? relativeError : 0;
 }
 
+/* Compares two arrays of doubles with the current comparator and returns the number of
+ * values considered different, their largest difference and its first index */
+static int compare_double_arrays(const double* a, const double* b, size_t n, const double* err,
+                                 double* maxdiff, size_t* imaxdiff)
+{
+    size_t i;
+    int countdiff = 0;
+    double dmax   = 0;
+
+    *maxdiff  = 0;
+    *imaxdiff = 0;
+    if (memcmp(a, b, n * sizeof(double)) == 0)
+        return 0;
+
+    /* Direct calls let the comparators be inlined */
+    if (compare_double == &compare_double_absolute) {
+        for (i = 0; i < n; i++) {
+            double d = compare_double_absolute(&a[i], &b[i], err);
+            countdiff += d != 0;
+            dmax = d > dmax ? d : dmax;
+        }
+    }
+    else {
+        for (i = 0; i < n; i++) {
+            double d = compare_double_relative(&a[i], &b[i], err);
+            countdiff += d != 0;
+            dmax = d > dmax ? d : dmax;
+        }
+    }
+
+    if (countdiff) {
+        for (i = 0; i < n; i++) {
+            if (compare_double(&a[i], &b[i], err) == dmax)
+                break;
+        }
+        *maxdiff  = dmax;
+        *imaxdiff = i;
+    }
+    return countdiff;
+}
+
 static int blocklisted(const char* name)
 {
     grib_string_list* b = blocklist;
@@ -991,8 +1032,7 @@ static int compare_values(grib_runtime_options* options, grib_handle* handle1, g
                 save_error(c, name);
             }
             if (err1 == GRIB_SUCCESS && err2 == GRIB_SUCCESS && len1 == len2) {
-                int imaxdiff = 0;
-                double diff;
+                size_t imaxdiff = 0;
                 double *pv1, *pv2;
                 maxdiff   = 0;
                 countdiff = 0;
@@ -1001,16 +1041,9 @@ static int compare_values(grib_runtime_options* options, grib_handle* handle1, g
                 value_tolerance *= tolerance_factor;
                 if (verbose)
                     printf("  (%d values) tolerance=%g\n", (int)len1, value_tolerance);
-                for (i = 0; i < len1; i++) {
-                    if ((diff = compare_double(pv1++, pv2++, &value_tolerance)) != 0) {
-                        countdiff++;
-                        if (maxdiff < diff) {
-                            maxdiff  = diff;
-                            imaxdiff = i;
-                        }
-                        err1 = GRIB_VALUE_MISMATCH;
-                    }
-                }
+                countdiff = compare_double_arrays(pv1, pv2, len1, &value_tolerance, &maxdiff, &imaxdiff);
+                if (countdiff)
+                    err1 = GRIB_VALUE_MISMATCH;
 
                 if (countdiff) {
                     printInfo(handle1);
@@ -1024,7 +1057,7 @@ static int compare_values(grib_runtime_options* options, grib_handle* handle1, g
                             if (!compareAbsolute)
                                 printf(" max");
                             printf(" relative diff. = %g", relative_error(dval1[imaxdiff], dval2[imaxdiff], value_tolerance));
-                            printf("\n\tmax diff. element %d: %.20e %.20e",
+                            printf("\n\tmax diff. element %zu: %.20e %.20e",
                                    imaxdiff, dval1[imaxdiff], dval2[imaxdiff]);
                             printf("\n\ttolerance=%.16e", value_tolerance);
                         }
@@ -1032,7 +1065,7 @@ static int compare_values(grib_runtime_options* options, grib_handle* handle1, g
                             /* One or both values are missing */
                             char* svalA = double_as_string(c, dval1[imaxdiff]);
                             char* svalB = double_as_string(c, dval2[imaxdiff]);
-                            printf("\tdiff. element %d: %s %s", imaxdiff, svalA, svalB);
+                            printf("\tdiff. element %zu: %s %s", imaxdiff, svalA, svalB);
                             grib_context_free(c, svalA);
                             grib_context_free(c, svalB);
                         }
@@ -31,6 +31,7 @@ grib_option grib_options[] = {
     { "g", 0, 0, 0, 1, 0 },
     { "T:", 0, 0, 1, 0, "B" },
     { "f", 0, 0, 0, 1, 0 },
+    { "j:", 0, 0, 0, 1, 0 },
     { "v", 0, 0, 0, 1, 0 },
     { "h", 0, 0, 0, 1, 0 },
 };
@@ -9,13 +9,16 @@
  */
 
 #include "grib_api_internal.h"
+#include "fingerprint.h"
 
 static int fail_on_error    = 1;
 static const char* toolname = NULL;
+static const char* filename = NULL;
+static grib_fingerprint_type hash_type;
 
 static void usage(const char* prog)
 {
-    printf("Usage: %s [-v] [-f] infile1 infile2 ... \n", prog);
+    printf("Usage: %s [-v] [-f] [-H xxh3|crc32c] infile1 infile2 ... \n", prog);
     exit(1);
 }
 
@@ -70,6 +73,52 @@ static int count_messages_slow(FILE* in, int message_type, unsigned long* count)
     return err;
 }
 
+// Print a fingerprint of each message straight from its bytes (no handle is created)
+static int hash_messages(FILE* in, int message_type, unsigned long* count)
+{
+    void* mesg   = NULL;
+    size_t size  = 0;
+    off_t offset = 0;
+    int err      = GRIB_SUCCESS;
+    char hex[GRIB_FINGERPRINT_MAX_LEN];
+    typedef void* (*wmo_read_proc)(FILE*, int, size_t*, off_t*, int*);
+    wmo_read_proc wmo_read = NULL;
+    grib_context* c        = grib_context_get_default();
+
+    if (message_type == CODES_GRIB)
+        wmo_read = wmo_read_grib_from_file_malloc;
+    else if (message_type == CODES_BUFR)
+        wmo_read = wmo_read_bufr_from_file_malloc;
+    else if (message_type == CODES_GTS)
+        wmo_read = wmo_read_gts_from_file_malloc;
+    else
+        wmo_read = wmo_read_any_from_file_malloc;
+
+    while (1) {
+        mesg = wmo_read(in, 0, &size, &offset, &err);
+        if (!mesg) {
+            if (err == GRIB_END_OF_FILE || err == GRIB_PREMATURE_END_OF_FILE || fail_on_error)
+                break;
+            continue;
+        }
+        if (err) {
+            grib_context_free(c, mesg);
+            if (fail_on_error)
+                break;
+            continue;
+        }
+        grib_fingerprint(hash_type, mesg, size, hex);
+        printf("%s %lld %zu %s\n", hex, (long long)offset, size, filename);
+        grib_context_free(c, mesg);
+        (*count)++;
+    }
+
+    if (err == GRIB_END_OF_FILE || (!fail_on_error && err == GRIB_PREMATURE_END_OF_FILE))
+        err = GRIB_SUCCESS;
+
+    return err;
+}
+
 // This version does not store the message contents (no malloc). Much faster
 static int count_messages_fast(FILE* in, int message_type, unsigned long* count)
 {
@@ -119,8 +168,7 @@ static int count_messages_fast(FILE* in, int message_type, unsigned long* count)
 int main(int argc, char* argv[])
 {
     FILE* infh = NULL;
-    char* filename;
-    int i, verbose = 0;
+    int i, verbose = 0, hash_mode = 0;
     int err = 0, files_processed = 0;
     unsigned long count_total = 0, count_curr = 0;
     int message_type = 0; // GRIB, BUFR etc
@@ -148,6 +196,13 @@ int main(int argc, char* argv[])
             fail_on_error = 0;
             continue;
         }
+        if (strcmp(argv[i], "-H") == 0) {
+            if (i + 1 >= argc || grib_fingerprint_type_from_name(argv[i + 1], &hash_type) != 0)
+                usage(toolname);
+            hash_mode = 1;
+            i++;
+            continue;
+        }
         filename = argv[i];
         if (path_is_directory(filename)) {
             fprintf(stderr, "%s: ERROR: \"%s\": Is a directory\n", toolname, filename);
@@ -160,6 +215,8 @@ int main(int argc, char* argv[])
         } else {
             infh = fopen(filename, "rb");
         }
+        if (hash_mode)
+            do_count = hash_messages;
         if (!infh) {
             perror(filename);
             exit(1);
@@ -192,7 +249,7 @@ int main(int argc, char* argv[])
     if (verbose) {
         printf("%7lu %s\n", count_total, "total");
     }
-    else {
+    else if (!hash_mode) {
         printf("%lu\n", count_total);
     }
 
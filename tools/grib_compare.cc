@@ -155,6 +155,47 @@ static double compare_double_relative(const double* a, const double* b, double t
     return relativeError > tolerance ? relativeError : 0;
 }
 
+/* Compares two arrays of doubles with the current comparator and returns the number of
+ * values considered different, their largest difference and its first index */
+static int compare_double_arrays(const double* a, const double* b, size_t n, double tolerance,
+                                 double* maxdiff, size_t* imaxdiff)
+{
+    size_t i;
+    int countdiff = 0;
+    double dmax   = 0;
+
+    *maxdiff  = 0;
+    *imaxdiff = 0;
+    if (memcmp(a, b, n * sizeof(double)) == 0)
+        return 0;
+
+    /* Direct calls let the comparators be inlined */
+    if (compare_double == &compare_double_absolute) {
+        for (i = 0; i < n; i++) {
+            double d = compare_double_absolute(&a[i], &b[i], tolerance);
+            countdiff += d != 0;
+            dmax = d > dmax ? d : dmax;
+        }
+    }
+    else {
+        for (i = 0; i < n; i++) {
+            double d = compare_double_relative(&a[i], &b[i], tolerance);
+            countdiff += d != 0;
+            dmax = d > dmax ? d : dmax;
+        }
+    }
+
+    if (countdiff) {
+        for (i = 0; i < n; i++) {
+            if (compare_double(&a[i], &b[i], tolerance) == dmax)
+                break;
+        }
+        *maxdiff  = dmax;
+        *imaxdiff = i;
+    }
+    return countdiff;
+}
+
 static void write_message(grib_handle* h, const char* str)
 {
     const void* m;
@@ -1002,8 +1043,7 @@ static int compare_values(grib_runtime_options* options, grib_handle* h1, grib_h
                 save_error(c, name);
             }
             if (err1 == GRIB_SUCCESS && err2 == GRIB_SUCCESS && len1 == len2) {
-                int imaxdiff;
-                double diff;
+                size_t imaxdiff;
                 double *pv1, *pv2, dnew1, dnew2;
                 maxdiff   = 0;
                 imaxdiff  = 0;
@@ -1033,16 +1073,11 @@ static int compare_values(grib_runtime_options* options, grib_handle* h1, grib_h
                         printf("using compare_double_relative");
                     printf("\n");
                 }
-                for (i = 0; i < len1; i++) {
-                    if ((diff = compare_double(pv1++, pv2++, value_tolerance)) != 0) {
-                        countdiff++;
-                        if (maxdiff < diff) {
-                            maxdiff  = diff;
-                            imaxdiff = i;
-                        }
-                        err1 = GRIB_VALUE_MISMATCH;
-                    }
-                }
+                /* For angles pv1/pv2 point to the single normalised first value (dnew1/dnew2):
+                 * reading len1 values from there would run past them */
+                countdiff = compare_double_arrays(pv1, pv2, isangle ? 1 : len1, value_tolerance, &maxdiff, &imaxdiff);
+                if (countdiff)
+                    err1 = GRIB_VALUE_MISMATCH;
 
                 if (countdiff) {
                     printInfo(h1);
@@ -1055,7 +1090,7 @@ static int compare_values(grib_runtime_options* options, grib_handle* h1, grib_h
                         if (!compareAbsolute)
                             printf(" max");
                         printf(" relative diff. = %g", relative_error(dval1[imaxdiff], dval2[imaxdiff], value_tolerance));
-                        printf("\n\tmax diff. element %d: %.20e %.20e",
+                        printf("\n\tmax diff. element %zu: %.20e %.20e",
                                imaxdiff, dval1[imaxdiff], dval2[imaxdiff]);
                         printf("\n\ttolerance=%.16e", value_tolerance);
                         if (packingError2 != 0 || packingError1 != 0)
@@ -48,6 +48,7 @@ grib_option grib_options[] = {
     { "G", 0, 0, 0, 1, 0 },
     { "7", 0, 0, 0, 1, 0 },
     { "X:", 0, 0, 0, 1, 0 },
+    { "j:", 0, 0, 0, 1, 0 },
     { "v", 0, 0, 0, 1, 0 },
     { "h", 0, 0, 0, 1, 0 },
 };
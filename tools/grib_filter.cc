@@ -24,6 +24,7 @@ grib_option grib_options[] = {
     { "G", 0, 0, 0, 1, 0 },
     { "T:", 0, 0, 0, 1, 0 },
     { "7", 0, 0, 0, 1, 0 },
+    { "j:", 0, 0, 0, 1, 0 },
     { "v", 0, 0, 0, 1, 0 },
     { "h", 0, 0, 0, 1, 0 },
 };
@@ -87,7 +88,7 @@ int grib_tool_new_handle_action(grib_runtime_options* options, grib_handle* h)
     err = grib_handle_apply_action(h, options->action);
     if (err != GRIB_SUCCESS && options->fail) {
         fprintf(stderr, "ERROR: %s (message %d)\n",
-                grib_get_error_message(err), h->context->handle_file_count);
+                grib_get_error_message(err), grib_context_get_handle_file_count(h->context));
         exit(err);
     }
     return 0;
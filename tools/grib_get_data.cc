@@ -10,8 +10,9 @@
 
 #include "grib_tools.h"
 
-static void print_key_values(grib_values* values, int values_count);
+static void print_key_values(grib_output_buffer* out, grib_values* values, int values_count);
 static grib_values* get_key_values(grib_runtime_options* options, grib_handle* h);
+static int write_binary_columns(grib_runtime_options* options, grib_handle* h);
 
 grib_option grib_options[] = {
     /*  {id, args, help}, on, command_line, value */
@@ -25,6 +26,13 @@ grib_option grib_options[] = {
     { "p:", 0, 0, 0, 1, 0 },
     { "F:", "format", "\n\t\tC style format for data values. Default is \"%.10e\"\n", 0, 1, 0 },
     { "L:", "format", "\n\t\tC style format for latitudes/longitudes. Default is \"%9.3f%9.3f\"\n", 0, 1, 0 },
+    { "o:", "output",
+      "\n\t\tWrite binary columns instead of text: latitudes to output.lat, longitudes to"
+      "\n\t\toutput.lon and data values to output.values, as little-endian IEEE numbers."
+      "\n\t\tThe coordinates are only written when the grid changes. Missing values are NaN."
+      "\n\t\tFor each message the offsets (in numbers) of its coordinates and values are printed.\n",
+      0, 1, 0 },
+    { "E:", "float|double", "\n\t\tType of the binary columns written with -o. Default is double.\n", 0, 1, 0 },
     { "w:", 0, 0, 0, 1, 0 },
     { "s:", 0, 0, 0, 1, 0 },
     { "f", 0, 0, 0, 1, 0 },
@@ -43,6 +51,22 @@ const char* tool_online_doc = "https://confluence.ecmwf.int/display/ECC/grib_get
 const char* tool_usage = "[options] grib_file grib_file ...";
 
 extern FILE* dump_file;
+static grib_output_buffer output; /* The values are written in large blocks */
+
+/* Binary columns, see the -o option */
+typedef struct binary_columns
+{
+    FILE* lat;
+    FILE* lon;
+    FILE* values;
+    int use_float;
+    char grid_md5[64];   /* md5GridSection of the coordinates last written */
+    long latlon_offset;  /* of the coordinates last written, -1 if none */
+    long latlon_count;   /* numbers written to the .lat and .lon files */
+    long values_count;   /* numbers written to the .values file */
+    long message_count;
+} binary_columns;
+static binary_columns columns;
 
 int grib_options_count = sizeof(grib_options) / sizeof(grib_option);
 
@@ -56,8 +80,41 @@ int grib_tool_before_getopt(grib_runtime_options* options)
     return 0;
 }
 
+static FILE* open_column(const char* output, const char* suffix)
+{
+    char name[1024] = {0,};
+    FILE* f         = NULL;
+    snprintf(name, sizeof(name), "%s.%s", output, suffix);
+    f = fopen(name, "wb");
+    if (!f) {
+        perror(name);
+        exit(1);
+    }
+    return f;
+}
+
 int grib_tool_init(grib_runtime_options* options)
 {
+    if (grib_options_on("E:") && !grib_options_on("o:")) {
+        fprintf(stderr, "ERROR: Option -E needs -o\n");
+        exit(1);
+    }
+    if (grib_options_on("o:")) {
+        const char* output = grib_options_get_option("o:");
+        if (grib_options_on("E:")) {
+            const char* type = grib_options_get_option("E:");
+            if (strcmp(type, "float") == 0)
+                columns.use_float = 1;
+            else if (strcmp(type, "double") != 0) {
+                fprintf(stderr, "ERROR: Invalid type \"%s\" for the binary columns (float or double)\n", type);
+                exit(1);
+            }
+        }
+        columns.lat           = open_column(output, "lat");
+        columns.lon           = open_column(output, "lon");
+        columns.values        = open_column(output, "values");
+        columns.latlon_offset = -1;
+    }
     return 0;
 }
 
@@ -102,6 +159,9 @@ int grib_tool_new_handle_action(grib_runtime_options* options, grib_handle* h)
             exit(err);
     }
 
+    if (columns.values)
+        return write_binary_columns(options, h);
+
     if (grib_options_on("m:")) {
         /* User wants to see missing values */
         char* theEnd = NULL;
@@ -217,6 +277,7 @@ int grib_tool_new_handle_action(grib_runtime_options* options, grib_handle* h)
     if (print_keys)
         values = get_key_values(options, h);
 
+    grib_output_buffer_init(&output, dump_file);
     if (skip_missing == 0) {
         /* Show missing values in data */
         for (i = 0; i < numberOfPoints; i++) {
@@ -227,17 +288,19 @@ int grib_tool_new_handle_action(grib_runtime_options* options, grib_handle* h)
                 else
                     is_missing_val = (data_values[i] == missingValue);
             }
-            if (iter)
-                fprintf(dump_file, format_latlons, lats[i], lons[i]);
+            if (iter) {
+                const double latlon[2] = { lats[i], lons[i] };
+                grib_output_buffer_printf(&output, format_latlons, latlon, 2);
+            }
 
             if (is_missing_val)
-                fprintf(dump_file, "%s", missing_string);
+                grib_output_buffer_puts(&output, missing_string);
             else
-                fprintf(dump_file, format_values, data_values[i]);
+                grib_output_buffer_double(&output, format_values, data_values[i]);
 
             if (print_keys)
-                print_key_values(values, options->print_keys_count);
-            fprintf(dump_file, "\n");
+                print_key_values(&output, values, options->print_keys_count);
+            grib_output_buffer_write(&output, "\n", 1);
         }
     }
     else if (skip_missing == 1) {
@@ -251,15 +314,18 @@ int grib_tool_new_handle_action(grib_runtime_options* options, grib_handle* h)
                     is_missing_val = (data_values[i] == missingValue);
             }
             if (!is_missing_val) {
-                if (iter)
-                    fprintf(dump_file, format_latlons, lats[i], lons[i]);
-                fprintf(dump_file, format_values, data_values[i]);
+                if (iter) {
+                    const double latlon[2] = { lats[i], lons[i] };
+                    grib_output_buffer_printf(&output, format_latlons, latlon, 2);
+                }
+                grib_output_buffer_double(&output, format_values, data_values[i]);
                 if (print_keys)
-                    print_key_values(values, options->print_keys_count);
-                fprintf(dump_file, "\n");
+                    print_key_values(&output, values, options->print_keys_count);
+                grib_output_buffer_write(&output, "\n", 1);
             }
         }
     }
+    grib_output_buffer_flush(&output);
 
     if (iter)
         grib_iterator_delete(iter);
@@ -284,14 +350,187 @@ int grib_tool_skip_handle(grib_runtime_options* options, grib_handle* h)
 
 int grib_tool_finalise_action(grib_runtime_options* options)
 {
+    if (columns.values) {
+        if (fclose(columns.lat) || fclose(columns.lon) || fclose(columns.values)) {
+            perror(grib_options_get_option("o:"));
+            exit(1);
+        }
+        columns.lat = columns.lon = columns.values = NULL;
+    }
+    return 0;
+}
+
+/* Write n numbers as little-endian float or double */
+static void write_column(FILE* f, const double* x, size_t n, int use_float)
+{
+    unsigned char buf[8 * 4096];
+    const size_t width = use_float ? 4 : 8;
+
+    while (n > 0) {
+        const size_t k = n < 4096 ? n : 4096;
+        size_t i;
+        for (i = 0; i < k; i++) {
+            unsigned char* p = buf + i * width;
+            if (use_float) {
+                const float v = (float)x[i];
+                memcpy(p, &v, 4);
+            }
+            else {
+                memcpy(p, &x[i], 8);
+            }
+#if IEEE_BE
+            for (size_t j = 0; j < width / 2; j++) {
+                const unsigned char t = p[j];
+                p[j]                  = p[width - 1 - j];
+                p[width - 1 - j]      = t;
+            }
+#endif
+        }
+        if (fwrite(buf, width, k, f) != k) {
+            perror(grib_options_get_option("o:"));
+            exit(1);
+        }
+        x += k;
+        n -= k;
+    }
+}
+
+/* Decoded values are in the order of the iterator only when scanning is +i+j.
+ * Otherwise some iterators (e.g. polar stereographic) reorder them */
+static int values_in_iterator_order(grib_handle* h)
+{
+    long iScansNegatively       = 0;
+    long jScansPositively       = 0;
+    long jPointsAreConsecutive  = 0;
+    long alternativeRowScanning = 0;
+
+    if (grib_get_long(h, "iScansNegatively", &iScansNegatively) != GRIB_SUCCESS ||
+        grib_get_long(h, "jScansPositively", &jScansPositively) != GRIB_SUCCESS ||
+        grib_get_long(h, "jPointsAreConsecutive", &jPointsAreConsecutive) != GRIB_SUCCESS)
+        return 0;
+    grib_get_long(h, "alternativeRowScanning", &alternativeRowScanning); /* Not in all editions */
+
+    return !iScansNegatively && jScansPositively && !jPointsAreConsecutive && !alternativeRowScanning;
+}
+
+/* The -o option. The coordinates are only computed when the grid changes;
+ * otherwise the values are decoded directly, without an iterator, when that
+ * gives them in the same order */
+static int write_binary_columns(grib_runtime_options* options, grib_handle* h)
+{
+    int err              = 0;
+    long numberOfPoints  = 0;
+    long hasMissingValues = 0;
+    double missingValue  = 0;
+    char md5[64]         = {0,};
+    size_t len           = sizeof(md5);
+    size_t size          = 0, i;
+    double *data_values = NULL, *lats = NULL, *lons = NULL;
+
+    if ((err = grib_get_long(h, "numberOfPoints", &numberOfPoints)) != GRIB_SUCCESS) {
+        fprintf(stderr, "ERROR: Unable to get number of points\n");
+        exit(err);
+    }
+    data_values = (double*)calloc(numberOfPoints + 1, sizeof(double));
+    if (!data_values) {
+        fprintf(stderr, "ERROR: Failed to allocate %zu bytes for data values (number of points=%ld)\n",
+                (numberOfPoints + 1) * sizeof(double), numberOfPoints);
+        exit(GRIB_OUT_OF_MEMORY);
+    }
+
+    if (grib_get_string(h, "md5GridSection", md5, &len) != GRIB_SUCCESS)
+        md5[0] = 0;
+
+    if (md5[0] == 0 || columns.latlon_offset < 0 || strcmp(md5, columns.grid_md5) != 0) {
+        grib_iterator* iter = grib_iterator_new(h, 0, &err);
+        if (iter) {
+            lats = (double*)calloc(numberOfPoints + 1, sizeof(double));
+            lons = (double*)calloc(numberOfPoints + 1, sizeof(double));
+            if (!lats || !lons) {
+                fprintf(stderr, "ERROR: Failed to allocate memory for the coordinates\n");
+                exit(GRIB_OUT_OF_MEMORY);
+            }
+            while (size <= (size_t)numberOfPoints && grib_iterator_next(iter, &lats[size], &lons[size], &data_values[size]))
+                size++;
+            grib_iterator_delete(iter);
+            if (size != (size_t)numberOfPoints) {
+                fprintf(stderr, "ERROR: Wrong number of points %ld\n", numberOfPoints);
+                exit(1);
+            }
+            write_column(columns.lat, lats, size, columns.use_float);
+            write_column(columns.lon, lons, size, columns.use_float);
+            columns.latlon_offset = columns.latlon_count;
+            columns.latlon_count += size;
+            snprintf(columns.grid_md5, sizeof(columns.grid_md5), "%s", md5);
+            free(lats);
+            free(lons);
+        }
+        else if (err == GRIB_NOT_IMPLEMENTED || err == GRIB_SUCCESS) {
+            /* No coordinates, e.g. spectral */
+            columns.latlon_offset = -1;
+            columns.grid_md5[0]   = 0;
+        }
+        else {
+            grib_context_log(h->context, GRIB_LOG_ERROR, "%s", grib_get_error_message(err));
+            exit(err);
+        }
+    }
+
+    if (size == 0 && columns.latlon_offset >= 0 && !values_in_iterator_order(h)) {
+        /* Same grid but not +i+j: the values must come from the iterator to match the coordinates */
+        double lat = 0, lon = 0;
+        grib_iterator* iter = grib_iterator_new(h, 0, &err);
+        if (!iter) {
+            grib_context_log(h->context, GRIB_LOG_ERROR, "%s", grib_get_error_message(err));
+            exit(err);
+        }
+        while (size <= (size_t)numberOfPoints && grib_iterator_next(iter, &lat, &lon, &data_values[size]))
+            size++;
+        grib_iterator_delete(iter);
+        if (size != (size_t)numberOfPoints) {
+            fprintf(stderr, "ERROR: Wrong number of points %ld\n", numberOfPoints);
+            exit(1);
+        }
+    }
+
+    if (size == 0) {
+        size = numberOfPoints;
+        err  = grib_get_double_array(h, "values", data_values, &size);
+        if (err) {
+            grib_context_log(h->context, GRIB_LOG_ERROR, "Cannot decode values: %s",
+                             grib_get_error_message(err));
+            exit(1);
+        }
+        if (size != (size_t)numberOfPoints) {
+            fprintf(stderr, "ERROR: Wrong number of points %ld\n", numberOfPoints);
+            exit(1);
+        }
+    }
+
+    GRIB_CHECK(grib_get_long(h, "missingValuesPresent", &hasMissingValues), 0);
+    if (hasMissingValues) {
+        GRIB_CHECK(grib_get_double(h, "missingValue", &missingValue), 0);
+        for (i = 0; i < size; i++)
+            if (data_values[i] == missingValue)
+                data_values[i] = NAN;
+    }
+    write_column(columns.values, data_values, size, columns.use_float);
+
+    if (columns.message_count++ == 0)
+        fprintf(dump_file, "LatLonOffset ValuesOffset NumberOfPoints\n");
+    fprintf(dump_file, "%ld %ld %zu\n", columns.latlon_offset, columns.values_count, size);
+    columns.values_count += size;
+
+    free(data_values);
     return 0;
 }
 
-static void print_key_values(grib_values* values, int values_count)
+static void print_key_values(grib_output_buffer* out, grib_values* values, int values_count)
 {
     int i = 0;
     for (i = 0; i < values_count; i++) {
-        fprintf(dump_file, " %s", values[i].string_value);
+        grib_output_buffer_write(out, " ", 1);
+        grib_output_buffer_puts(out, values[i].string_value);
     }
 }
 
@@ -44,6 +44,9 @@ static grib_options_help grib_options_help_list[] = {
     { "i:", "index",
       "\n\t\tData value corresponding to the given index is printed.\n" },
     { "j", 0, "JSON mode (JavaScript Object Notation).\n" },
+    { "j:", "threads",
+      "\n\t\tProcess the messages on the given number of threads."
+      "\n\t\tThe output is the same, and in the same order, as with a single thread.\n" },
     { "l:", "latitude,longitude[,MODE,file]",
       "\n\t\tValue close to the point of a latitude,longitude (nearest neighbour)."
       "\n\t\tAllowed values for MODE are:"
@@ -154,6 +157,17 @@ int grib_options_command_line(const char* id)
     return 0;
 }
 
+/* Whether the tool gives the option a meaning of its own rather than the one in grib_options_help_list */
+static int option_has_own_args(const char* id)
+{
+    int i = 0;
+    for (i = 0; i < grib_options_count; i++) {
+        if (!strcmp(id, grib_options[i].id))
+            return grib_options[i].args != NULL;
+    }
+    return 0;
+}
+
 int grib_options_on(const char* id)
 {
     int i = 0;
@@ -251,6 +265,15 @@ int grib_process_runtime_options(grib_context* context, int argc, char** argv, g
     else
         options->json_output = 0;
 
+    /* bufr_dump has its own -j option */
+    if (grib_options_on("j:") && !option_has_own_args("j:")) {
+        options->threads = atoi(grib_options_get_option("j:"));
+        if (options->threads < 1) {
+            fprintf(stderr, "%s: Invalid number of threads: %s\n", tool_name, grib_options_get_option("j:"));
+            exit(1);
+        }
+    }
+
     if (grib_options_on("X:"))
         options->infile_offset = atol(grib_options_get_option("X:"));
 
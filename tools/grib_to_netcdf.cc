@@ -707,7 +707,7 @@ typedef struct fieldset
  #define grib_context_free(ctx,x)           grib_context_free(ctx,x)
  */
 
-static field* get_field(fieldset* v, int n, field_state shape);
+static field* get_field(fieldset* v, int n, field_state shape, err* e);
 static hypercube* new_hypercube_from_mars_request(const request* r);
 static void release_field(field* g);
 static int count_axis(const hypercube* h);
@@ -1033,6 +1033,9 @@ static err to_expand_mem(field* g)
         g->values = (double*)grib_context_malloc(ctx, sizeof(double) * g->value_count);
         if ((e = grib_get_double_array(g->handle, "values", g->values, &count))) {
             grib_context_log(ctx, GRIB_LOG_ERROR, "ecCodes: cannot decode values: %s", grib_get_error_message(e));
+            /* Do not leave a half-filled array behind: it would never be decoded again */
+            grib_context_free(ctx, g->values);
+            g->values = NULL;
             return e;
         }
 
@@ -1056,15 +1059,17 @@ static err to_expand_mem(field* g)
     return e;
 }
 
-static void set_field_state(field* g, field_state shape)
+static err set_field_state(field* g, field_state shape)
 {
+    err e = 0;
+
     switch (shape) {
         case expand_mem:
-            to_expand_mem(g);
+            e = to_expand_mem(g);
             break;
 
         case packed_mem:
-            to_packed_mem(g);
+            e = to_packed_mem(g);
             break;
 
         case packed_file:
@@ -1075,12 +1080,17 @@ static void set_field_state(field* g, field_state shape)
             grib_context_log(ctx, GRIB_LOG_FATAL, "Internal error %s %d", __FILE__, __LINE__);
             break;
     }
+
+    return e;
 }
 
-static field* get_field(fieldset* v, int n, field_state shape)
+/* If e is not NULL, it receives the error of the state change */
+static field* get_field(fieldset* v, int n, field_state shape, err* e)
 {
     field* g = v->fields[n];
-    set_field_state(g, shape);
+    err ret  = set_field_state(g, shape);
+    if (e)
+        *e = ret;
     return g;
 }
 
@@ -1872,6 +1882,7 @@ typedef struct ncoptions
     bool climatology; /* Whether this dataset is climatology */
     bool shuffle;
     long deflate;
+    long timechunk; /* Chunk length along the time axis when deflating */
 } ncoptions_t;
 
 ncoptions_t setup;
@@ -2091,6 +2102,7 @@ static void get_nc_options(const request* user_r)
     const char* refdate            = get_value(user_r, "referencedate", 0);
     const char* shuffle            = get_value(user_r, "shuffle", 0);
     const char* deflate            = get_value(user_r, "deflate", 0);
+    const char* timechunk          = get_value(user_r, "timechunk", 0);
 
     const char* title     = get_value(user_r, "title", 0);
     const char* history   = get_value(user_r, "history", 0);
@@ -2098,6 +2110,7 @@ static void get_nc_options(const request* user_r)
 
     setup.shuffle      = shuffle ? (strcmp(shuffle, "true") == 0) : false;
     setup.deflate      = deflate ? ((strcmp(deflate, "none") == 0) ? -1 : atol(deflate)) : -1;
+    setup.timechunk    = timechunk ? atol(timechunk) : 1;
     setup.usevalidtime = validtime ? (strcmp(validtime, "true") == 0) : false;
     setup.refdate      = refdate ? atol(refdate) : 19000101;
     setup.auto_refdate = refdate ? (strcmp(get_value(user_r, "referencedate", 0), "AUTOMATIC") == 0) : false;
@@ -2246,7 +2259,7 @@ static int def_latlon(int ncid, fieldset* fs)
     size_t nlats = 0, nlons = 0;
     err e = 0;
 
-    field* g = get_field(fs, 0, expand_mem);
+    field* g = get_field(fs, 0, expand_mem, NULL);
 
     DEBUG_ASSERT(check_grid(g) == GRIB_SUCCESS);
 
@@ -2277,7 +2290,7 @@ static int put_latlon(int ncid, fieldset* fs)
     int stat   = 0;
     err e      = 0;
 
-    field* g = get_field(fs, 0, expand_mem);
+    field* g = get_field(fs, 0, expand_mem, NULL);
 
     double* dvalues = NULL;
     float* fvalues  = NULL;
@@ -2391,31 +2404,19 @@ static int compute_scale(dataset_t* subset)
     char test_scaled_min    = 0;
     char test_scaled_median = 0;
 
-    err e = 0;
-
     fieldset* fs = subset->fset;
     int idx      = subset->att.nctype;
 
     for (i = 0; i < fs->count; i++) {
-        field* g = get_field(fs, i, expand_mem);
-        size_t len;
-        static double* vals    = NULL;
-        static size_t vals_len = 0;
-
-        if ((e = grib_get_size(g->handle, "values", &len)) != GRIB_SUCCESS) {
-            grib_context_log(ctx, GRIB_LOG_ERROR, "ecCodes: cannot get size of values: %s", grib_get_error_message(e));
-            return e;
-        }
+        /* expand_mem has already decoded the values: no need to decode them again */
+        err e              = 0;
+        field* g           = get_field(fs, i, expand_mem, &e);
+        const double* vals = g->values;
+        size_t len         = g->value_count;
 
-        if (len > vals_len) {
-            if (vals)
-                grib_context_free(ctx, vals);
-            vals     = (double*)grib_context_malloc(ctx, sizeof(double) * len);
-            vals_len = len;
-        }
-        if ((e = grib_get_double_array(g->handle, "values", vals, &len)) != GRIB_SUCCESS) {
-            grib_context_log(ctx, GRIB_LOG_ERROR, "ecCodes: cannot get values: %s", grib_get_error_message(e));
-            return e;
+        if (e != GRIB_SUCCESS || !vals) {
+            release_field(g);
+            return e ? e : GRIB_INTERNAL_ERROR;
         }
 
         if (g->has_bitmap) {
@@ -2768,7 +2769,7 @@ static int put_data(hypercube* h, int ncid, const char* name, dataset_t* subset)
     char** times_array      = NULL;
     size_t times_array_size = 0;
     fieldset* fs            = subset->fset;
-    field* f                = get_field(fs, 0, expand_mem);
+    field* f                = get_field(fs, 0, expand_mem, NULL);
 
     void* vscaled       = NULL;
     size_t vscaled_length = 0;
@@ -2810,31 +2811,20 @@ static int put_data(hypercube* h, int ncid, const char* name, dataset_t* subset)
     times_array = create_times_array(h->cube, &times_array_size);
 
     for (i = 0; i < fs->count; i++) {
-        field* g = get_field(fs, i, expand_mem);
-        size_t len;
-        static double* vals    = NULL;
-        static size_t vals_len = 0;
-        bool missing        = 0;
+        /* expand_mem has already decoded the values: no need to decode them again */
+        field* g     = get_field(fs, i, expand_mem, &e);
+        double* vals = g->values;
+        size_t len   = g->value_count;
+        bool missing = 0;
 
         request* r;
         int j = 0;
         int idx[1024];
         int idxsize = 1024;
 
-        if ((e = grib_get_size(g->handle, "values", &len)) != GRIB_SUCCESS) {
-            grib_context_log(ctx, GRIB_LOG_ERROR, "ecCodes: cannot get size of values: %s", grib_get_error_message(e));
-            return e;
-        }
-
-        if (len > vals_len) {
-            if (vals)
-                grib_context_free(ctx, vals);
-            vals     = (double*)grib_context_malloc(ctx, sizeof(double) * len);
-            vals_len = len;
-        }
-        if ((e = grib_get_double_array(g->handle, "values", vals, &len)) != GRIB_SUCCESS) {
-            grib_context_log(ctx, GRIB_LOG_ERROR, "ecCodes: cannot get values: %s", grib_get_error_message(e));
-            return e;
+        if (e != GRIB_SUCCESS || !vals) {
+            release_field(g);
+            return e ? e : GRIB_INTERNAL_ERROR;
         }
 
         // bool missing = (g->ksec4[0] < 0); /* If negative number of values, field is missing */
@@ -2925,7 +2915,7 @@ static int define_netcdf_dimensions(hypercube* h, fieldset* fs, int ncid, datase
     long ni;
     long nj;
 
-    field* f = get_field(fs, 0, expand_mem);
+    field* f = get_field(fs, 0, expand_mem, NULL);
 
     if ((e = check_grid(f)) != GRIB_SUCCESS) {
         release_field(f);
@@ -2966,6 +2956,10 @@ static int define_netcdf_dimensions(hypercube* h, fieldset* fs, int ncid, datase
         const char* longname = (char*)lowaxis;
         n                   = count_values(cube, axis);
 
+        /* Several time steps per chunk make time series reads cheaper */
+        if (strcmp(axis, "time") == 0 && setup.timechunk > 1)
+            chunks[naxis - i - 1] = setup.timechunk < n ? setup.timechunk : n;
+
         if (count_values(data_r, "levtype") > 1) {
             grib_context_log(ctx, GRIB_LOG_ERROR, "Cannot handle fields for different levtypes.\n");
             grib_context_log(ctx, GRIB_LOG_ERROR, "Please split input data into different files. Exiting!\n");
@@ -3100,7 +3094,8 @@ static int define_netcdf_dimensions(hypercube* h, fieldset* fs, int ncid, datase
 #endif
         }
         if (subsets[i].scale) {
-            compute_scale(&subsets[i]);
+            if ((e = compute_scale(&subsets[i])) != GRIB_SUCCESS)
+                return e;
             stat = nc_put_att_double(ncid, var_id, "scale_factor", NC_DOUBLE, 1, &subsets[i].scale_factor);
             check_err("nc_put_att_double", stat, __LINE__);
 
@@ -3641,7 +3636,7 @@ static int split_fieldset(fieldset* fs, request* data_r, dataset_t** subsets, co
 
     for (i = 0; i < fs->count; ++i) {
         bool ok = false;
-        field* f   = get_field(fs, i, packed_mem);
+        field* f   = get_field(fs, i, packed_mem, NULL);
         request* g = field_to_request(f);
         int j      = 0;
 
@@ -3934,6 +3929,10 @@ grib_option grib_options[] = {
       "\n\t\tChunking strategy based on GRIB message.\n",
       0, 1, "6" },
     { "s", 0, "Shuffle data before deflation compression.\n", 0, 1, 0 },
+    { "C:", "steps",
+      "\n\t\tNumber of time steps per chunk. Only used with the deflate option."
+      "\n\t\tDefault 1 (one GRIB message per chunk).\n",
+      0, 1, "1" },
     { "u:", "dimension", "\n\t\tSet dimension to be an unlimited dimension.\n", 0, 1, "time" },
     { "h", 0, 0, 0, 1, 0 },
 };
@@ -4112,6 +4111,21 @@ int grib_tool_init(grib_runtime_options* options)
     else
         set_value(user_r, "shuffle", "false");
 
+    if (grib_options_on("C:")) {
+        char* theArg = grib_options_get_option("C:");
+        if (!is_number(theArg) || atol(theArg) < 1) {
+            fprintf(stderr, "Invalid chunk option: %s (must be a positive number)\n", theArg);
+            usage();
+            exit(1);
+        }
+        if (!deflate_option) {
+            fprintf(stderr, "Invalid chunk option. Deflate option needed.\n");
+            usage();
+            exit(1);
+        }
+        set_value(user_r, "timechunk", theArg);
+    }
+
     if (grib_options_on("R:")) {
         char* theArg = grib_options_get_option("R:");
         if (!is_number(theArg)) {
@@ -4361,7 +4375,14 @@ int grib_tool_finalise_action(grib_runtime_options* options)
         if (subsets[i].fset) {
             char dataset[100];
             snprintf(dataset, sizeof(dataset), subsets[i].att.name, i + 1);
-            put_data(dims, ncid, dataset, &subsets[i]);
+            if (put_data(dims, ncid, dataset, &subsets[i]) != GRIB_SUCCESS) {
+                stat = nc_close(ncid);
+                check_err("nc_close", stat, __LINE__);
+                stat = nc_delete(options->outfile->name);
+                check_err("nc_delete", stat, __LINE__);
+
+                exit(1);
+            }
         }
         else {
             grib_context_log(ctx, GRIB_LOG_ERROR, "Fieldset %d is empty!!", i + 1);
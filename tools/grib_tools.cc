@@ -112,7 +112,8 @@ static grib_runtime_options global_options = {
     0, /* skip_all  */
     {{0,},}, /* grib_values tolerance[MAX_KEYS] */
     0, /* infile_offset */
-    0  /* JSON output */
+    0, /* JSON output */
+    1  /* threads */
 };
 
 static grib_handle* grib_handle_new_from_file_x(grib_context* c, FILE* f, int mode, int headers_only, int* err)
@@ -331,6 +332,241 @@ static std::string guess_file_product(const std::string& filename)
     return result;
 }
 
+#if GRIB_PTHREADS
+/* With -j N the main thread reads the messages and emits their results in
+ * order while N workers run the per-message actions. The workers capture
+ * what the actions write and the main thread replays it, so the output is
+ * the same as that of a serial run. At most 2N messages are in flight. */
+
+typedef struct grib_tools_job
+{
+    grib_handle* h;
+    int err;
+    int file_count;
+    int total_count;
+    int skip;
+    int skip_all;
+    int done;
+    grib_output_capture output;
+} grib_tools_job;
+
+typedef struct grib_tools_pipeline
+{
+    grib_runtime_options* options;
+    grib_tools_job* jobs; /* ring buffer */
+    size_t size;
+    size_t next_read;  /* next job to fill */
+    size_t next_work;  /* next job for a worker */
+    size_t next_write; /* next job to emit */
+    int stop;
+    pthread_mutex_t mutex;
+    pthread_cond_t work_ready;
+    pthread_cond_t job_done;
+} grib_tools_pipeline;
+
+typedef struct grib_tools_worker_arg
+{
+    grib_tools_pipeline* pipeline;
+    grib_runtime_options* options;
+    grib_tools_file infile; /* counts of its own, the main thread keeps the real ones */
+} grib_tools_worker_arg;
+
+static void* grib_tools_worker(void* arg)
+{
+    grib_tools_pipeline* pl       = ((grib_tools_worker_arg*)arg)->pipeline;
+    grib_runtime_options* options = ((grib_tools_worker_arg*)arg)->options;
+    grib_tools_job* job           = NULL;
+
+    pthread_mutex_lock(&pl->mutex);
+    for (;;) {
+        while (!pl->stop && pl->next_work == pl->next_read)
+            pthread_cond_wait(&pl->work_ready, &pl->mutex);
+        if (pl->next_work == pl->next_read)
+            break;
+        job = &pl->jobs[pl->next_work++ % pl->size];
+        pthread_mutex_unlock(&pl->mutex);
+
+        if (job->h) {
+            grib_context_set_thread_handle_counts(job->file_count, job->total_count);
+            grib_output_capture_start(&job->output);
+
+            options->skip_all = 0;
+            grib_skip_check(options, job->h);
+            job->skip     = options->skip;
+            job->skip_all = options->skip_all;
+            if (options->skip && options->strict) {
+                grib_tool_skip_handle(options, job->h);
+                job->h = NULL;
+            }
+            else {
+                grib_tool_new_handle_action(options, job->h);
+            }
+
+            grib_output_capture_stop();
+            grib_context_set_thread_handle_counts(-1, -1);
+        }
+
+        pthread_mutex_lock(&pl->mutex);
+        job->done = 1;
+        pthread_cond_broadcast(&pl->job_done);
+    }
+    pthread_mutex_unlock(&pl->mutex);
+    return NULL;
+}
+
+/* Emit the oldest job, in the same way as the serial loop, or drop it once
+ * a 'count' constraint has stopped the processing */
+static void grib_tools_emit_job(grib_tools_pipeline* pl, grib_tools_file* infile)
+{
+    grib_runtime_options* options = pl->options;
+    grib_tools_job* job           = &pl->jobs[pl->next_write % pl->size];
+    int err                       = 0;
+
+    pthread_mutex_lock(&pl->mutex);
+    while (!job->done)
+        pthread_cond_wait(&pl->job_done, &pl->mutex);
+    pl->next_write++;
+    pthread_mutex_unlock(&pl->mutex);
+
+    if (options->skip_all) {
+        /* Read ahead of the message that stopped the processing */
+        grib_output_capture_clear(&job->output);
+        if (job->h)
+            grib_handle_delete(job->h);
+        infile->handle_count--;
+        options->handle_count--;
+        return;
+    }
+
+    if (!job->h && job->err != GRIB_SUCCESS) {
+        grib_failed *failed = NULL, *p = NULL;
+        grib_no_handle_action(options, job->err);
+
+        failed        = (grib_failed*)grib_context_malloc_clear(options->context, sizeof(grib_failed));
+        failed->count = infile->handle_count;
+        failed->error = job->err;
+        failed->next  = NULL;
+        if (!infile->failed) {
+            infile->failed = failed;
+        }
+        else {
+            p = infile->failed;
+            while (p->next)
+                p = p->next;
+            p->next = failed;
+        }
+        return;
+    }
+
+    options->skip     = job->skip;
+    options->skip_all = job->skip_all;
+    if (!job->skip) {
+        options->filter_handle_count++;
+        infile->filter_handle_count++;
+    }
+
+    if ((err = grib_output_capture_flush(&job->output)) != GRIB_SUCCESS) {
+        fprintf(stderr, "%s: %s\n", tool_name, grib_get_error_message(err));
+        exit(err);
+    }
+
+    if (job->h) {
+        grib_context_set_thread_handle_counts(job->file_count, job->total_count);
+        grib_print_key_values(options, job->h);
+        grib_context_set_thread_handle_counts(-1, -1);
+        grib_handle_delete(job->h);
+    }
+}
+
+static void grib_tools_process_file_threaded(grib_runtime_options* options, grib_tools_file* infile)
+{
+    grib_context* c = grib_context_get_default();
+    grib_tools_pipeline pl;
+    pthread_t* workers            = NULL;
+    grib_tools_worker_arg* args   = NULL;
+    grib_runtime_options* wopts   = NULL;
+    grib_handle* h                = NULL;
+    int err                       = 0;
+    int i;
+
+    memset(&pl, 0, sizeof(pl));
+    pl.options = options;
+    pl.size    = 2 * options->threads;
+    pl.jobs    = (grib_tools_job*)calloc(pl.size, sizeof(grib_tools_job));
+    workers    = (pthread_t*)calloc(options->threads, sizeof(pthread_t));
+    args       = (grib_tools_worker_arg*)calloc(options->threads, sizeof(grib_tools_worker_arg));
+    wopts      = (grib_runtime_options*)calloc(options->threads, sizeof(grib_runtime_options));
+    if (!pl.jobs || !workers || !args || !wopts) {
+        fprintf(stderr, "%s: Failed to allocate memory for %d threads\n", tool_name, options->threads);
+        exit(1);
+    }
+    pthread_mutex_init(&pl.mutex, NULL);
+    pthread_cond_init(&pl.work_ready, NULL);
+    pthread_cond_init(&pl.job_done, NULL);
+    for (i = 0; i < options->threads; i++) {
+        memcpy(&wopts[i], options, sizeof(grib_runtime_options));
+        args[i].infile          = *infile;
+        args[i].pipeline        = &pl;
+        args[i].options         = &wopts[i];
+        wopts[i].current_infile = &args[i].infile;
+        pthread_create(&workers[i], NULL, grib_tools_worker, &args[i]);
+    }
+
+    while (!options->skip_all && ((h = grib_handle_new_from_file_x(c, infile->file, options->mode,
+                                                                   options->headers_only, &err)) != NULL ||
+                                  err != GRIB_SUCCESS)) {
+        grib_tools_job* job = NULL;
+
+        infile->handle_count++;
+        options->handle_count++;
+
+        if (c->no_fail_on_wrong_length && (err == GRIB_PREMATURE_END_OF_FILE || err == GRIB_WRONG_LENGTH))
+            err = 0;
+        if (!options->error) {
+            /* ECC-1086: Do not clear a previous error */
+            options->error = err;
+        }
+
+        if (h)
+            grib_print_header(options, h);
+
+        if (pl.next_read - pl.next_write == pl.size)
+            grib_tools_emit_job(&pl, infile);
+
+        job = &pl.jobs[pl.next_read % pl.size];
+        memset(job, 0, sizeof(*job));
+        job->h           = h;
+        job->err         = err;
+        job->file_count  = grib_context_get_handle_file_count(c);
+        job->total_count = grib_context_get_handle_total_count(c);
+        job->done        = (h == NULL);
+        job->output.context = c;
+
+        pthread_mutex_lock(&pl.mutex);
+        pl.next_read++;
+        pthread_cond_signal(&pl.work_ready);
+        pthread_mutex_unlock(&pl.mutex);
+    }
+    while (pl.next_write != pl.next_read)
+        grib_tools_emit_job(&pl, infile);
+
+    pthread_mutex_lock(&pl.mutex);
+    pl.stop = 1;
+    pthread_cond_broadcast(&pl.work_ready);
+    pthread_mutex_unlock(&pl.mutex);
+    for (i = 0; i < options->threads; i++)
+        pthread_join(workers[i], NULL);
+
+    pthread_cond_destroy(&pl.job_done);
+    pthread_cond_destroy(&pl.work_ready);
+    pthread_mutex_destroy(&pl.mutex);
+    free(wopts);
+    free(args);
+    free(workers);
+    free(pl.jobs);
+}
+#endif
+
 static int grib_tool_without_orderby(grib_runtime_options* options)
 {
     int err = 0;
@@ -381,6 +617,13 @@ static int grib_tool_without_orderby(grib_runtime_options* options)
         grib_tool_new_file_action(options, infile);
         /*nofail=grib_options_on("f");*/
 
+#if GRIB_PTHREADS
+        /* JSON output prints the keys of each message as it is read */
+        if (options->threads > 1 && !options->json_output) {
+            grib_tools_process_file_threaded(options, infile);
+        }
+        else
+#endif
         while (!options->skip_all && ((h = grib_handle_new_from_file_x(c, infile->file, options->mode,
                                                                        options->headers_only, &err)) != NULL ||
                                       err != GRIB_SUCCESS)) {
@@ -796,8 +1039,8 @@ static void grib_tools_set_print_keys(grib_runtime_options* options, grib_handle
             const char* all_namespace_vals[1024] = {NULL,}; // sorted array containing all namespaces
             printf("ERROR: namespace \"%s\" does not contain any key.\n", ns);
             printf("Here are the available namespaces in this message:\n");
-            for (i = 0; i < ACCESSORS_ARRAY_SIZE; i++) {
-                grib_accessor* anAccessor = h->accessors[i];
+            for (i = 0; i < (int)h->accessors_size; i++) {
+                grib_accessor* anAccessor = h->accessors[i].accessor;
                 if (anAccessor) {
                     for (j = 0; j < MAX_ACCESSOR_NAMES; j++) {
                         const char* a_namespace = anAccessor->all_name_spaces[j];
@@ -1371,13 +1614,99 @@ static int filenames_equal(const char* f1, const char* f2)
     return eq;
 }
 
+/* Output file names already checked against the input file. Resolving both paths
+ * costs a dozen system calls, so when the output name is a template such as
+ * out_[shortName]_[step].grib each name is only resolved the first time it is
+ * written while reading a given input file. Open addressing; cleared when full */
+#define CHECKED_OUTPUTS_SIZE 4096 /* a power of 2 */
+
+static struct
+{
+    char* infile;
+    char* names[CHECKED_OUTPUTS_SIZE];
+    size_t count;
+} checked_outputs;
+
+#if GRIB_PTHREADS
+static pthread_mutex_t checked_outputs_mutex = PTHREAD_MUTEX_INITIALIZER;
+#define CHECKED_OUTPUTS_LOCK() pthread_mutex_lock(&checked_outputs_mutex)
+#define CHECKED_OUTPUTS_UNLOCK() pthread_mutex_unlock(&checked_outputs_mutex)
+#else
+#define CHECKED_OUTPUTS_LOCK()
+#define CHECKED_OUTPUTS_UNLOCK()
+#endif
+
+/* Must be called with the lock held */
+static void checked_outputs_clear()
+{
+    size_t i;
+    for (i = 0; i < CHECKED_OUTPUTS_SIZE; i++) {
+        free(checked_outputs.names[i]);
+        checked_outputs.names[i] = NULL;
+    }
+    checked_outputs.count = 0;
+}
+
+/* Must be called with the lock held. Returns the slot of filename,
+ * which is empty if the name has not been checked yet */
+static char** checked_outputs_slot(const char* filename)
+{
+    unsigned long h = 2166136261UL; /* FNV-1a */
+    const char* p   = filename;
+    size_t i;
+    while (*p) {
+        h ^= (unsigned char)*p++;
+        h *= 16777619UL;
+    }
+    for (i = h & (CHECKED_OUTPUTS_SIZE - 1);; i = (i + 1) & (CHECKED_OUTPUTS_SIZE - 1)) {
+        if (!checked_outputs.names[i] || !grib_inline_strcmp(checked_outputs.names[i], filename))
+            return &checked_outputs.names[i];
+    }
+}
+
+static int output_is_input(const char* infile, const char* filename)
+{
+    int checked = 0, eq = 0;
+    char** slot = NULL;
+
+    CHECKED_OUTPUTS_LOCK();
+    if (!checked_outputs.infile || grib_inline_strcmp(checked_outputs.infile, infile)) {
+        checked_outputs_clear();
+        free(checked_outputs.infile);
+        checked_outputs.infile = strdup(infile);
+    }
+    checked = *checked_outputs_slot(filename) != NULL;
+    CHECKED_OUTPUTS_UNLOCK();
+    if (checked)
+        return 0;
+
+    eq = filenames_equal(infile, filename);
+    if (!eq) {
+        CHECKED_OUTPUTS_LOCK();
+        if (checked_outputs.infile && !grib_inline_strcmp(checked_outputs.infile, infile)) {
+            /* Keep the table at most half full so that probing stays short */
+            if (checked_outputs.count >= CHECKED_OUTPUTS_SIZE / 2)
+                checked_outputs_clear();
+            slot = checked_outputs_slot(filename);
+            if (!*slot) {
+                *slot = strdup(filename);
+                checked_outputs.count++;
+            }
+        }
+        CHECKED_OUTPUTS_UNLOCK();
+    }
+    return eq;
+}
+
 void grib_tools_write_message(grib_runtime_options* options, grib_handle* h)
 {
     const void* buffer;
     size_t size;
-    grib_file* of       = NULL;
-    int err             = 0;
-    char filename[1024] = {0,};
+    grib_file* of           = NULL;
+    grib_output_capture* oc = NULL;
+    grib_tools_file* infile = NULL;
+    int err                 = 0;
+    char filename[1024]     = {0,};
     Assert(options->outfile != NULL && options->outfile->name != NULL);
 
     /* See ECC-1086
@@ -1392,12 +1721,30 @@ void grib_tools_write_message(grib_runtime_options* options, grib_handle* h)
     err = grib_recompose_name(h, NULL, options->outfile->name, filename, 0);
 
     /* Check outfile is not same as infile */
-    if (filenames_equal(options->infile->name, filename)) {
+    infile = options->current_infile ? options->current_infile : options->infile;
+    if (output_is_input(infile->name, filename)) {
         grib_context_log(h->context, GRIB_LOG_ERROR,
                 "output file '%s' is the same as input file. Aborting\n", filename);
         exit(GRIB_IO_PROBLEM);
     }
 
+    if ((oc = grib_output_capture_current()) != NULL) {
+        /* Processing on several threads (-j): written later, in message order */
+        const char gts_trailer[4] = { '\x0D', '\x0D', '\x0A', '\x03' };
+        err = GRIB_SUCCESS;
+        if (options->gts && h->gts_header)
+            err = grib_output_capture_add(oc, filename, "w", 1, h->gts_header, h->gts_header_len);
+        if (!err)
+            err = grib_output_capture_add(oc, filename, "w", 1, buffer, size);
+        if (!err && options->gts && h->gts_header)
+            err = grib_output_capture_add(oc, filename, "w", 1, gts_trailer, 4);
+        if (err) {
+            grib_context_log(h->context, GRIB_LOG_ERROR, "unable to write message\n");
+            exit(err);
+        }
+        return;
+    }
+
     of = grib_file_open(filename, "w", &err);
 
     if (!of || !of->handle) {
@@ -173,6 +173,7 @@ typedef struct grib_runtime_options
     grib_values tolerance[MAX_KEYS];
     off_t infile_offset;
     int json_output;
+    int threads;
 } grib_runtime_options;
 
 extern grib_option grib_options[];